@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "command/profiler_t.hpp"
+#include "explorer/context_t.hpp"
+#include "explorer/index_t.hpp"
+
+namespace ingress_drone_explorer {
+
+namespace events {
+
+class channel_t;
+
+} // namespace events
+
+struct explorer_options_t {
+    // Bytes, 0 for unlimited
+    size_t  _memory_limit = 0;
+    bool    _memory_statistics = false;
+    // Count the hardware and software events of each phase
+    bool    _profile = false;
+};
+
+struct checkpoint_options_t {
+    std::string             _filename;
+    std::chrono::seconds    _interval;
+    // Continue from the file if it matches
+    bool                    _resume = false;
+};
+
+struct cache_options_t {
+    std::string _directory;
+    // Bytes of all entries before evicting the least recently used ones
+    uintmax_t   _size_limit;
+};
+
+// Drives the index and a context for the command, and emits the results as events.
+class explorer_t {
+public:
+    explorer_t(events::channel_t& channel, const explorer_options_t& options = { });
+
+public:
+    void load_portals(const std::vector<std::string>& filenames);
+    void load_keys(const std::string& filename);
+    void summarize();
+    // Place the cells on the NUMA nodes and pin this thread to the node owning the start
+    void place_on_nodes();
+    void pin_to_node_of(const coordinate_t& start);
+    // Reachable cells by the nodes owning them
+    void report_nodes() const;
+    void explore_from(
+        const coordinate_t& start,
+        const std::optional<checkpoint_options_t>& checkpoint_options = { },
+        const std::optional<cache_options_t>& cache_options = { }
+    );
+    void analyze_radii_from(const coordinate_t& start, const std::vector<double>& radii);
+    void analyze_keys_from(const coordinate_t& start);
+    void search_from(const coordinate_t& start, const coordinate_t& target);
+    void search_from(const coordinate_t& start, const std::string& target_guid);
+    void report() const;
+    void save_drawn_items_to(const std::string& filename) const;
+
+private:
+    void search_from(const coordinate_t& start, const s2::cell_t& target_cell, const coordinate_t& target);
+    // Seconds since the start plus the ones before resuming
+    void finish_exploration(
+        const std::chrono::steady_clock::time_point& start_time, const double resumed_seconds = 0
+    ) const;
+    // Bracket a phase for the memory statistics and the profile, cells is the count to report the events per cell
+    void begin_phase() const;
+    void end_phase(const char* phase, const size_t cells = 0) const;
+    // Bytes in use and the peaks of the phase by structure
+    void report_memory(const char* phase) const;
+    void report_profile(const char* phase, const size_t cells) const;
+
+    events::channel_t&          _channel;
+    const explorer_options_t    _options;
+    // Only if profiling
+    std::unique_ptr<profiler_t> _profiler;
+
+    index_t                     _index;
+    context_t                   _context;
+    // Pinned to
+    size_t                      _node = 0;
+};
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace ingress_drone_explorer {
+
+// Hardware and software counters of the process by perf_event_open on Linux, counted between start and stop. Each
+// counter is opened on its own, so the unsupported ones are left out instead of failing all.
+class profiler_t {
+public:
+    enum class counter_t {
+        cycles,
+        instructions,
+        cache_misses,
+        branch_misses,
+        page_faults,
+    };
+
+    static constexpr size_t _counters_count = 5;
+
+    struct sample_t {
+        double                                              _seconds = 0;
+        // Empty if the counter is unavailable
+        std::array<std::optional<uint64_t>, _counters_count> _values;
+
+        inline const std::optional<uint64_t>& operator[](const counter_t counter) const {
+            return _values[static_cast<size_t>(counter)];
+        }
+    };
+
+public:
+    profiler_t();
+    ~profiler_t();
+
+    profiler_t(const profiler_t&) = delete;
+    profiler_t& operator=(const profiler_t&) = delete;
+
+public:
+    static const char* name_of(const counter_t counter);
+
+    // Reasons of the unavailable counters, empty if all are available
+    inline const std::string& error() const {
+        return _error;
+    }
+
+    void start();
+    sample_t stop();
+
+private:
+    std::array<int, _counters_count>        _descriptors;
+    std::string                             _error;
+    std::chrono::steady_clock::time_point   _start_time;
+};
+
+} // namespace ingress_drone_explorer
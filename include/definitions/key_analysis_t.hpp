@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "portal_t.hpp"
+
+namespace ingress_drone_explorer {
+
+struct key_impact_t {
+    portal_t    _portal;
+    size_t      _alone_cells_count = 0;
+    size_t      _alone_portals_count = 0;
+    size_t      _marginal_cells_count = 0;
+    size_t      _marginal_portals_count = 0;
+};
+
+struct key_analysis_t {
+    size_t                      _base_reachable_cells_count = 0;
+    size_t                      _base_reachable_portals_count = 0;
+    size_t                      _reachable_cells_count = 0;
+    size_t                      _reachable_portals_count = 0;
+    std::vector<key_impact_t>   _impacts;
+};
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ingress_drone_explorer {
+
+struct radius_reachability_t {
+    double  _radius = 0;
+    size_t  _reachable_cells_count = 0;
+    size_t  _reachable_portals_count = 0;
+};
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "portal_t.hpp"
+
+namespace ingress_drone_explorer {
+
+struct furthest_portal_t {
+    portal_t    _portal;
+    double      _distance = 0;
+};
+
+struct report_t {
+    // Width in meters of the bins of the distance histogram
+    static constexpr double _distance_bin_width = 5000;
+    static constexpr size_t _furthest_portals_limit = 10;
+
+    size_t      _cells_count = 0;
+    size_t      _reachable_cells_count = 0;
+    size_t      _portals_count = 0;
+    size_t      _reachable_portals_count = 0;
+    portal_t    _furthest_portal;
+    double      _furthest_distance = 0;
+    // Furthest first, by great-circle distance
+    std::vector<furthest_portal_t>  _furthest_portals;
+    // Reachable Portals by the distance from the start
+    std::vector<size_t>             _distance_histogram;
+    // Reachable cells by the hops from the start cells, empty unless explored flatly
+    std::vector<size_t>             _depth_histogram;
+};
+
+} // namespace ingress_drone_explorer
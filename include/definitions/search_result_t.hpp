@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "portal_t.hpp"
+#include "s2/cell_t.hpp"
+
+namespace ingress_drone_explorer {
+
+struct hop_t {
+    s2::cell_t              _cell;
+    portal_t                _portal;
+    std::optional<portal_t> _key;
+};
+
+struct search_result_t {
+    bool                _found = false;
+    size_t              _discovered_cells_count = 0;
+    std::vector<hop_t>  _hops;
+};
+
+} // namespace ingress_drone_explorer
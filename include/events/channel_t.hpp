@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <thread>
+
+#include <boost/json/object.hpp>
+
+#include "utils/ring_buffer.hpp"
+
+namespace ingress_drone_explorer {
+
+namespace events {
+
+enum class format_t {
+    human,
+    ndjson,
+    quiet,
+};
+
+// Events are formatted by the emitting thread and written by a background thread, so the emitting thread never waits
+// for the console.
+class channel_t {
+public:
+    using printer_t = std::function<void(std::ostream&)>;
+
+    explicit channel_t(const format_t format);
+    ~channel_t();
+
+    channel_t(const channel_t&) = delete;
+    channel_t& operator=(const channel_t&) = delete;
+
+public:
+    inline format_t format() const {
+        return _format;
+    }
+
+    void emit(const char* name, boost::json::object&& data, const printer_t& print);
+
+    // Lossy and rate-limited by the writer, cheap enough to call in hot loops
+    inline void progress(const char* phase, const size_t done, const size_t total) {
+        if (_format != format_t::quiet) {
+            _buffer.try_push({ phase, done, total, { } });
+        }
+    }
+
+private:
+    struct entry_t {
+        const char* _phase = nullptr;   // Progress if not null
+        size_t      _done = 0;
+        size_t      _total = 0;
+        std::string _line;
+    };
+
+    static constexpr auto _progress_interval = std::chrono::milliseconds(1000);
+    static constexpr auto _idle_interval = std::chrono::milliseconds(5);
+
+    void write(std::stop_token stop_token);
+    void write_progress(const entry_t& entry) const;
+
+    const format_t                  _format;
+    ring_buffer_t<entry_t, 1024>    _buffer;
+    std::jthread                    _writer;
+};
+
+} // namespace events
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ingress_drone_explorer {
+
+// Reads regular files one after another in large aligned blocks, keeping several reads in flight across the files by
+// io_uring on Linux, or by a thread of pread where io_uring is unavailable. The files are consumed in order through
+// their stream buffers, which hand out the completed blocks as they are, so parsing overlaps reading. A file is opened
+// once its first block is assigned and closed once its last one is handed out, so only the files in the read-ahead
+// window are open.
+class async_reader_t {
+public:
+    static constexpr size_t _block_size = 1 << 20;
+    static constexpr size_t _depth = 8;
+    static constexpr size_t _alignment = 4096;
+
+    // Hands out the blocks of one file, reading a later file skips the rest of the earlier ones
+    class buffer_t : public std::streambuf {
+    public:
+        inline buffer_t(async_reader_t& reader, const size_t file) : _reader(reader), _file(file) { }
+
+    protected:
+        int_type underflow() override;
+
+    private:
+        async_reader_t& _reader;
+        const size_t    _file;
+    };
+
+public:
+    // The buffers are allocated from the resource
+    async_reader_t(const std::vector<std::string>& filenames, std::pmr::memory_resource* resource);
+    ~async_reader_t();
+
+    async_reader_t(const async_reader_t&) = delete;
+    async_reader_t& operator=(const async_reader_t&) = delete;
+
+public:
+    // Open the file if it's not yet, false if unable to
+    bool open(const size_t file);
+
+    inline buffer_t& buffer_of(const size_t file) {
+        return _buffers[file];
+    }
+
+    // "io_uring" or "pread"
+    const char* backend() const;
+
+private:
+    struct file_t {
+        std::string _filename;
+        int         _descriptor = -1;
+        uint64_t    _size = 0;
+        // Blocks assigned and not handed out yet
+        size_t      _pending = 0;
+        bool        _opened = false;
+        bool        _failed = false;
+    };
+
+    struct slot_t {
+        char*       _data = nullptr;
+        size_t      _file = 0;
+        uint64_t    _offset = 0;
+        size_t      _length = 0;
+        // Bytes read or the negative error number, valid once done
+        int64_t     _result = 0;
+        bool        _submitted = false;
+        bool        _done = false;
+    };
+
+    struct ring_t;
+
+    // The completed block of the file at the head, false at the end of the file
+    bool next(const size_t file, char*& data, size_t& length);
+    // Assign the next block of the files to the slot and start reading it, leave it idle if all are assigned
+    void submit(slot_t& slot);
+    // Close the file if no more blocks of it will be assigned and none is pending
+    void close_if_done(const size_t file);
+    void wait(slot_t& slot);
+    void read(std::stop_token stop_token);
+    // Wait for the reads in flight and free everything, also if the construction fails
+    void release();
+
+    std::pmr::memory_resource*  _resource;
+    std::vector<file_t>         _files;
+    std::deque<buffer_t>        _buffers;
+    std::vector<slot_t>         _slots;
+    // Slot to be consumed next, and if it's handed out to a buffer
+    size_t                      _head = 0;
+    bool                        _handed = false;
+    // Next block to assign
+    size_t                      _next_file = 0;
+    uint64_t                    _next_offset = 0;
+
+    // io_uring if available
+    std::unique_ptr<ring_t>     _ring;
+
+    // The pread thread otherwise
+    std::mutex                  _mutex;
+    std::condition_variable_any _condition;
+    std::deque<slot_t*>         _requests;
+    std::jthread                _reader;
+};
+
+} // namespace ingress_drone_explorer
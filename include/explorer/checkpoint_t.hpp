@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "definitions/coordinate_t.hpp"
+#include "s2/cell_t.hpp"
+
+namespace ingress_drone_explorer {
+
+// Snapshots of an exploration saved to a binary file periodically, tied to the dataset digest and the start. The
+// exploring thread only copies the state, a background thread writes it.
+class checkpoint_t {
+public:
+    struct state_t {
+        uint64_t                _digest = 0;
+        coordinate_t            _start;
+        // Seconds explored before the snapshot, accumulated over resumes
+        double                  _seconds = 0;
+        std::vector<s2::cell_t> _queue;
+        // Hops from the start cells of the queued cells
+        std::vector<uint32_t>   _queue_depths;
+        std::vector<s2::cell_t> _reachable_cells;
+        // Cells containing Keys not reached yet
+        std::vector<s2::cell_t> _key_cells;
+        // Reachable cells by the hops from the start cells
+        std::vector<size_t>     _depth_histogram;
+    };
+
+public:
+    checkpoint_t(
+        const std::string& filename,
+        const std::chrono::milliseconds interval,
+        const uint64_t digest,
+        const coordinate_t& start
+    );
+    ~checkpoint_t();
+
+    checkpoint_t(const checkpoint_t&) = delete;
+    checkpoint_t& operator=(const checkpoint_t&) = delete;
+
+public:
+    // Load the saved state if it matches the dataset and the start
+    bool resume();
+
+    inline const std::optional<state_t>& resumed() const {
+        return _resumed;
+    }
+
+    inline bool due() const {
+        return std::chrono::steady_clock::now() >= _next_time;
+    }
+
+    // Queue the state to write with the digest, start and seconds filled, replaces the state not written yet if any
+    void save(state_t&& state);
+
+    // Wait for the writes and remove the file, should be called once the exploration is finished
+    void remove();
+
+    // Message of the last failed write, empty if none
+    std::string error() const;
+
+private:
+    void write(std::stop_token stop_token);
+
+    const std::string                               _filename;
+    const std::chrono::milliseconds                 _interval;
+    const uint64_t                                  _digest;
+    const coordinate_t                              _start;
+    const std::chrono::steady_clock::time_point     _start_time;
+    std::chrono::steady_clock::time_point           _next_time;
+    std::optional<state_t>                          _resumed;
+
+    mutable std::mutex                              _mutex;
+    std::condition_variable_any                     _condition;
+    std::optional<state_t>                          _pending;
+    bool                                            _writing = false;
+    std::string                                     _error;
+    std::jthread                                    _writer;
+};
+
+} // namespace ingress_drone_explorer
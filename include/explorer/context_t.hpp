@@ -0,0 +1,83 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "definitions/key_analysis_t.hpp"
+#include "definitions/radius_reachability_t.hpp"
+#include "definitions/report_t.hpp"
+#include "definitions/search_result_t.hpp"
+#include "explorer/checkpoint_t.hpp"
+#include "explorer/index_t.hpp"
+
+namespace ingress_drone_explorer {
+
+// State of queries against an index, lightweight and should be used by one thread at a time.
+class context_t {
+public:
+    using cell_set_t = index_t::cell_set_t;
+    using progress_callback_t = std::function<void(const size_t reached, const size_t total)>;
+
+public:
+    inline explicit context_t(const index_t& index)
+        : _index(index), _reachable_cells(&index.memory()._exploration) { }
+
+public:
+    // Continue from the resumed state of the checkpoint if any and save to it periodically, only for the flat
+    // exploration since the hierarchical one is quick enough
+    void explore_from(
+        const coordinate_t& start, const progress_callback_t& on_progress = { }, checkpoint_t* checkpoint = nullptr
+    );
+    // Take the reachable cells explored before from the same start cells instead of exploring, e.g. from a cache
+    void restore(const coordinate_t& start, const std::vector<s2::cell_t>& reachable_cells);
+    // Gathered while reaching the cells, only the totals and the order of the furthest Portals are left
+    report_t report() const;
+
+    std::vector<radius_reachability_t> analyze_radii_from(
+        const coordinate_t& start, const std::vector<double>& radii
+    ) const;
+    key_analysis_t analyze_keys_from(const coordinate_t& start) const;
+    search_result_t search_from(
+        const coordinate_t& start, const s2::cell_t& target_cell, const coordinate_t& target
+    ) const;
+
+    // Cells within the visible radius of the start, which determine the reachable cells
+    cell_set_t start_cells_of(const coordinate_t& start) const;
+
+    inline const coordinate_t& start() const {
+        return _start;
+    }
+
+    inline const cell_set_t& reachable_cells() const {
+        return _reachable_cells;
+    }
+
+private:
+    using cell_portals_map_t = index_t::cell_portals_map_t;
+    using portal_set_t = index_t::portal_set_t;
+    // Pending cells with their hops from the start cells
+    using cell_depth_map_t = std::pmr::map<s2::cell_t, uint32_t>;
+
+    static constexpr auto _visible_radius = index_t::_visible_radius;
+    static constexpr auto _reachable_radius_with_key = index_t::_reachable_radius_with_key;
+    static constexpr size_t _progress_mask = 0xFF;
+
+    void explore_hierarchically(const progress_callback_t& on_progress);
+    void reset(const coordinate_t& start);
+    // Count the Portals of a reached cell into the report
+    void reach(const portal_set_t& portals);
+
+    const index_t&  _index;
+
+    coordinate_t    _start;
+    cell_set_t      _reachable_cells;
+
+    // Accumulated by reach, the furthest Portals is a min-heap of the distance
+    size_t                                          _reachable_portals_count = 0;
+    std::vector<std::pair<double, const portal_t*>> _furthest_portals;
+    std::vector<size_t>                             _distance_histogram;
+    std::vector<size_t>                             _depth_histogram;
+};
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "definitions/portal_t.hpp"
+#include "explorer/memory_t.hpp"
+#include "s2/cell_t.hpp"
+
+namespace ingress_drone_explorer {
+
+// Portals and Keys grouped by cells, should be left untouched once loaded so it can be shared by contexts in threads.
+class index_t {
+public:
+    // Allocated from the counting resources of the index
+    using portal_set_t = std::pmr::set<portal_t>;
+    using cell_set_t = std::pmr::set<s2::cell_t>;
+    using cell_portals_map_t = std::pmr::map<s2::cell_t, portal_set_t>;
+
+    // Where a Portal is stored, the GUID viewed as the key lives in the stored Portal
+    struct location_t {
+        s2::cell_t      _cell;
+        const portal_t* _portal;
+    };
+    using guid_map_t = std::pmr::unordered_map<std::string_view, location_t>;
+
+    struct file_statistics_t {
+        std::string _filename;
+        size_t      _portals_count = 0;
+        size_t      _cells_count = 0;
+    };
+
+    struct keys_statistics_t {
+        size_t _loaded_count = 0;
+        size_t _matched_count = 0;
+    };
+
+    using file_callback_t = std::function<void(const file_statistics_t&)>;
+
+    struct node_statistics_t {
+        size_t _cells_count = 0;
+        size_t _portals_count = 0;
+        // Bytes of the chunks on the node
+        size_t _bytes = 0;
+    };
+
+    // Summary of a parent cell for hierarchical exploration
+    struct summary_t {
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
+        // Populated children
+        std::pmr::vector<s2::cell_t>    _cells;
+        // All the children are reachable from each other without leaving the parent
+        bool                            _connected = false;
+        // Cells outside the parent reachable from any child, only for connected parents
+        std::pmr::vector<s2::cell_t>    _exits;
+
+        inline explicit summary_t(const allocator_type& allocator = { }) : _cells(allocator), _exits(allocator) { }
+
+        inline summary_t(const summary_t& other, const allocator_type& allocator = { })
+            : _cells(other._cells, allocator), _connected(other._connected), _exits(other._exits, allocator) { }
+
+        inline summary_t(summary_t&& other, const allocator_type& allocator)
+            : _cells(std::move(other._cells), allocator), _connected(other._connected),
+            _exits(std::move(other._exits), allocator) { }
+    };
+    using summary_map_t = std::pmr::map<s2::cell_t, summary_t>;
+    using edges_map_t = std::pmr::map<s2::cell_t, std::pmr::vector<s2::cell_t>>;
+
+    static constexpr double _visible_radius = 500;
+    static constexpr double _reachable_radius_with_key = 1250;
+    static constexpr uint8_t _summary_level = 13;
+
+public:
+    // Allocations beyond the memory limit in bytes throw memory_limit_error, 0 for unlimited
+    explicit index_t(const size_t memory_limit = 0);
+
+    index_t(const index_t&) = delete;
+    index_t& operator=(const index_t&) = delete;
+
+public:
+    // Files could be JSON arrays or NDJSON with one Portal per line, - for the standard input
+    size_t load_portals(const std::vector<std::string>& filenames, const file_callback_t& on_file_loaded = { });
+    keys_statistics_t load_keys(const std::string& filename);
+
+    inline const cell_portals_map_t& cells() const {
+        return _cells;
+    }
+
+    inline const cell_portals_map_t& cells_containing_keys() const {
+        return _cells_containing_keys;
+    }
+
+    inline size_t portals_count() const {
+        return _portals_count;
+    }
+
+    // Lookup in the GUID index
+    const portal_t* find(const std::string& guid) const;
+
+    // Hash of the Portals and the matched Keys, identifies the dataset of checkpoints
+    uint64_t digest() const;
+
+    // Copy the cells onto the NUMA nodes in spatial ranges of equal cell counts, the Portals loaded later go to the
+    // nodes of their ranges. There is one range on a single node, and the pages are placed by the first touch of this
+    // thread if binding is denied. Should be called after loading, before sharing with contexts.
+    std::vector<node_statistics_t> place_on_nodes();
+
+    inline bool placed() const {
+        return _placed;
+    }
+
+    // Node owning the range of the cell, 0 if not placed
+    inline size_t node_of(const s2::cell_t& cell) const {
+        return std::upper_bound(_node_bounds.begin(), _node_bounds.end(), cell) - _node_bounds.begin();
+    }
+
+    // Precompute the parent summaries, should be called after loading Portals and Keys, loading again drops them.
+    void summarize();
+
+    inline bool summarized() const {
+        return !_summaries.empty();
+    }
+
+    inline const summary_map_t& summaries() const {
+        return _summaries;
+    }
+
+    // Reachable cells of each child in the parents not connected
+    inline const edges_map_t& edges() const {
+        return _edges;
+    }
+
+    // Shared by the contexts, the resources are safe to allocate from in threads
+    inline memory_t& memory() const {
+        return *_memory;
+    }
+
+    static inline s2::cell_t parent_of(const s2::cell_t& cell) {
+        const auto shift = cell._level - _summary_level;
+        return { cell._face, cell._i >> shift, cell._j >> shift, _summary_level };
+    }
+
+private:
+    void load_portals_from(std::istream& in, file_statistics_t& statistics);
+    void load_portals_as_lines_from(std::istream& in, file_statistics_t& statistics);
+    void insert(const std::vector<portal_t>& portals, file_statistics_t& statistics);
+
+    // Outlives the structures allocated from it
+    std::unique_ptr<memory_t>   _memory;
+
+    cell_portals_map_t          _cells;
+    guid_map_t                  _guids;
+    cell_portals_map_t          _cells_containing_keys;
+    size_t                      _portals_count = 0;
+    bool                        _placed = false;
+    // First cells of the nodes but the first
+    std::vector<s2::cell_t>     _node_bounds;
+
+    summary_map_t               _summaries;
+    edges_map_t                 _edges;
+};
+
+} // namespace ingress_drone_explorer
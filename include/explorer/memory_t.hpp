@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "explorer/numa_t.hpp"
+#include "utils/counting_resource.hpp"
+
+namespace ingress_drone_explorer {
+
+// Memory resources of the structures of an index and its contexts, all of them are charged to one total checked
+// against the limit, 0 for unlimited.
+struct memory_t {
+    size_t              _limit;
+    memory_counter_t    _total;
+
+    // Transient JSON documents of the lists and drawn items
+    counting_resource_t _json           { "JSON documents", _total, _limit };
+    // Blocks of the files in flight
+    counting_resource_t _reading        { "read buffers", _total, _limit };
+    // Upstream of the Portals, on the NUMA nodes once placed
+    numa_resource_t     _placement;
+    // Cells and Portals, including their GUIDs and titles
+    counting_resource_t _portals        { "Portals", _total, _limit, &_placement };
+    // Locations of the Portals by GUID
+    counting_resource_t _guids          { "GUID index", _total, _limit };
+    counting_resource_t _keys           { "Keys", _total, _limit };
+    counting_resource_t _summaries      { "summaries", _total, _limit };
+    // Reachable cells and queues of the contexts
+    counting_resource_t _exploration    { "exploration", _total, _limit };
+    counting_resource_t _drawn_items    { "drawn items", _total, _limit };
+
+    inline explicit memory_t(const size_t limit = 0) : _limit(limit) { }
+
+    memory_t(const memory_t&) = delete;
+    memory_t& operator=(const memory_t&) = delete;
+
+    inline std::array<const counting_resource_t*, 8> resources() const {
+        return { &_json, &_reading, &_portals, &_guids, &_keys, &_summaries, &_exploration, &_drawn_items };
+    }
+
+    // Start a new phase, the peaks will be of the phase only
+    inline void reset_peaks() {
+        _total.reset_peak();
+        for (
+            auto* resource : { &_json, &_reading, &_portals, &_guids, &_keys, &_summaries, &_exploration, &_drawn_items }
+        ) {
+            resource->reset_peak();
+        }
+    }
+};
+
+} // namespace ingress_drone_explorer
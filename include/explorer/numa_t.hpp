@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace ingress_drone_explorer {
+
+// NUMA nodes with memory and their CPUs from sysfs on Linux, a single node without CPUs to pin elsewhere.
+class numa_t {
+public:
+    struct node_t {
+        int                 _id = 0;
+        std::vector<int>    _cpus;
+    };
+
+public:
+    // Detected once
+    static const numa_t& topology();
+
+    inline const std::vector<node_t>& nodes() const {
+        return _nodes;
+    }
+
+    // Restrict the calling thread to the CPUs of the node, false if not possible
+    bool pin_to(const size_t node) const;
+    // Move the pages of the range to the node, which should be aligned to pages, false if not possible
+    bool bind(void* address, const size_t size, const size_t node) const;
+
+private:
+    numa_t();
+
+    std::vector<node_t> _nodes;
+};
+
+// Allocates from the upstream until placing, then from pools on chunks bound to the selected node, which is chosen by
+// the only thread allocating. The chunks are kept until destruction.
+class numa_resource_t : public std::pmr::memory_resource {
+public:
+    static constexpr size_t _chunk_size = 4 << 20;
+    static constexpr size_t _page_size = 4096;
+
+public:
+    explicit numa_resource_t(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    ~numa_resource_t();
+
+    numa_resource_t(const numa_resource_t&) = delete;
+    numa_resource_t& operator=(const numa_resource_t&) = delete;
+
+public:
+    // Start placing on the nodes of the topology
+    void place();
+
+    inline bool placing() const {
+        return !_arenas.empty();
+    }
+
+    inline void select(const size_t node) {
+        _node = node;
+    }
+
+    // Bytes of the chunks on the node
+    size_t bytes_on(const size_t node) const;
+    // The chunks are bound by the kernel, otherwise they're placed by the first touch of the allocating thread
+    inline bool bound() const {
+        return _bound;
+    }
+
+private:
+    class arena_t;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    using pool_t = std::pmr::unsynchronized_pool_resource;
+
+    std::pmr::memory_resource*                              _upstream;
+    std::vector<std::unique_ptr<arena_t>>                   _arenas;
+    std::vector<std::unique_ptr<pool_t>>                    _pools;
+    // Beginning and node of the chunks by the end
+    std::map<const char*, std::pair<const char*, size_t>>   _chunks;
+    size_t                                                  _node = 0;
+    bool                                                    _bound = true;
+};
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "s2/cell_t.hpp"
+
+namespace ingress_drone_explorer {
+
+// Reachable cells on disk keyed by the dataset digest and the start cells, since any start with the same start cells
+// reaches the same cells. Entries are files replaced at once by renaming, so processes could share the directory, and
+// the least recently used ones are removed beyond the size limit.
+class result_cache_t {
+public:
+    result_cache_t(const std::filesystem::path& directory, const uintmax_t size_limit);
+
+public:
+    std::optional<std::vector<s2::cell_t>> find(
+        const uint64_t digest, const std::vector<s2::cell_t>& start_cells
+    ) const;
+
+    // Cells should be sorted
+    void store(
+        const uint64_t digest, const std::vector<s2::cell_t>& start_cells, const std::vector<s2::cell_t>& cells
+    ) const;
+
+private:
+    std::filesystem::path path_of(const uint64_t digest, const std::vector<s2::cell_t>& start_cells) const;
+    void evict() const;
+
+    const std::filesystem::path _directory;
+    const uintmax_t             _size_limit;
+};
+
+} // namespace ingress_drone_explorer
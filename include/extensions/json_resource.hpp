@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory_resource>
+
+#include <boost/json/memory_resource.hpp>
+
+namespace ingress_drone_explorer {
+
+// Boost.JSON has its own memory resource type, forward its allocations to a standard one to count them.
+class json_resource_t : public boost::json::memory_resource {
+public:
+    inline explicit json_resource_t(std::pmr::memory_resource& resource) : _resource(resource) { }
+
+private:
+    inline void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        return _resource.allocate(bytes, alignment);
+    }
+
+    inline void do_deallocate(void* pointer, const std::size_t bytes, const std::size_t alignment) override {
+        _resource.deallocate(pointer, bytes, alignment);
+    }
+
+    inline bool do_is_equal(const boost::json::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource& _resource;
+};
+
+} // namespace ingress_drone_explorer
@@ -8,6 +8,12 @@ struct coordinate_t;
 struct drawn_item_t;
 struct portal_t;
 
+namespace s2 {
+
+struct cell_t;
+
+} // namespace s2
+
 template<typename T>
 inline void extract(const boost::json::object& object, const boost::json::string_view& key, T& to);
 
@@ -16,5 +22,12 @@ portal_t tag_invoke(const boost::json::value_to_tag<portal_t>&, const boost::jso
 
 void tag_invoke(const boost::json::value_from_tag&, boost::json::value& value, const drawn_item_t& tag);
 void tag_invoke(const boost::json::value_from_tag&, boost::json::value& value, const coordinate_t& tag);
+void tag_invoke(const boost::json::value_from_tag&, boost::json::value& value, const portal_t& tag);
+
+namespace s2 {
+
+void tag_invoke(const boost::json::value_from_tag&, boost::json::value& value, const cell_t& tag);
+
+} // namespace s2
 
 } // namespace ingress_drone_explorer
\ No newline at end of file
@@ -9,6 +9,9 @@ namespace ingress_drone_explorer {
 
 struct coordinate_t;
 
+// Parse "longitude,latitude" and check the range, return false if invalid.
+bool parse(const std::string& value, coordinate_t& coordinate);
+
 void validate(boost::any& v, const std::vector<std::string>& values, coordinate_t*, int);
 
 } // namespace ingress_drone_explorer
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+// C interface of the explorer library, intended to be loaded by services in other languages.
+// An index is loaded once and could be shared by contexts in different threads, but each context should be used by
+// one thread at a time. Functions returning int return 0 on success and -1 on failure, call ide_last_error() to get
+// the message of the last failure in the calling thread.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#   if defined(INGRESS_DRONE_EXPLORER_EXPORTS)
+#       define IDE_API __declspec(dllexport)
+#   elif defined(INGRESS_DRONE_EXPLORER_SHARED)
+#       define IDE_API __declspec(dllimport)
+#   else
+#       define IDE_API
+#   endif
+#else
+#   define IDE_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ide_index_t ide_index_t;
+typedef struct ide_context_t ide_context_t;
+
+typedef struct ide_cell_t {
+    uint8_t face;
+    uint8_t level;
+    int32_t i;
+    int32_t j;
+} ide_cell_t;
+
+typedef struct ide_report_t {
+    size_t      cells_count;
+    size_t      reachable_cells_count;
+    size_t      portals_count;
+    size_t      reachable_portals_count;
+    // Valid until the next call on the same context, NULL if nothing is reachable
+    const char* furthest_guid;
+    const char* furthest_title;
+    double      furthest_lng;
+    double      furthest_lat;
+    double      furthest_distance;
+} ide_report_t;
+
+typedef struct ide_portal_t {
+    const char* guid;
+    const char* title;
+    double      lng;
+    double      lat;
+} ide_portal_t;
+
+typedef struct ide_radius_reachability_t {
+    double  radius;
+    size_t  reachable_cells_count;
+    size_t  reachable_portals_count;
+} ide_radius_reachability_t;
+
+typedef struct ide_key_impact_t {
+    ide_portal_t    portal;
+    size_t          alone_cells_count;
+    size_t          alone_portals_count;
+    size_t          marginal_cells_count;
+    size_t          marginal_portals_count;
+} ide_key_impact_t;
+
+typedef struct ide_key_analysis_t {
+    size_t                  base_reachable_cells_count;
+    size_t                  base_reachable_portals_count;
+    size_t                  reachable_cells_count;
+    size_t                  reachable_portals_count;
+    // Valid until the next call on the same context
+    const ide_key_impact_t* impacts;
+    size_t                  impacts_count;
+} ide_key_analysis_t;
+
+typedef struct ide_hop_t {
+    ide_cell_t      cell;
+    ide_portal_t    portal;
+    // Key used to reach the next cell, guid is NULL if reached by visibility
+    ide_portal_t    key;
+} ide_hop_t;
+
+typedef struct ide_search_result_t {
+    int                 found;
+    size_t              discovered_cells_count;
+    // Valid until the next call on the same context
+    const ide_hop_t*    hops;
+    size_t              hops_count;
+} ide_search_result_t;
+
+IDE_API const char* ide_last_error(void);
+
+IDE_API ide_index_t* ide_index_create(void);
+IDE_API void ide_index_destroy(ide_index_t* index);
+IDE_API int ide_index_load_portals(ide_index_t* index, const char* const* filenames, size_t count);
+IDE_API int ide_index_load_keys(ide_index_t* index, const char* filename);
+IDE_API size_t ide_index_portals_count(const ide_index_t* index);
+// Summarize parent cells after loading so explorations reach connected ones at once, with identical results
+IDE_API int ide_index_summarize(ide_index_t* index);
+// Place the cells on the NUMA nodes in spatial ranges after loading, before creating contexts in threads. Route each
+// start to a thread pinned to the node of its start cell. A single node is one range.
+IDE_API int ide_index_place_on_nodes(ide_index_t* index);
+// Index of the node owning the cell of the coordinate, 0 if not placed
+IDE_API size_t ide_index_node_of(const ide_index_t* index, double lng, double lat);
+
+IDE_API size_t ide_numa_nodes_count(void);
+// Restrict the calling thread to the CPUs of the node by index
+IDE_API int ide_numa_pin_thread_to(size_t node);
+
+IDE_API ide_context_t* ide_context_create(const ide_index_t* index);
+IDE_API void ide_context_destroy(ide_context_t* context);
+IDE_API int ide_context_explore_from(ide_context_t* context, double lng, double lat);
+IDE_API int ide_context_report(ide_context_t* context, ide_report_t* report);
+// Results are sorted by radius, results should have room for count items
+IDE_API int ide_context_analyze_radii(
+    ide_context_t* context, double lng, double lat, const double* radii, size_t count,
+    ide_radius_reachability_t* results
+);
+IDE_API int ide_context_analyze_keys(ide_context_t* context, double lng, double lat, ide_key_analysis_t* analysis);
+IDE_API int ide_context_search_to_portal(
+    ide_context_t* context, double lng, double lat, const char* target_guid, ide_search_result_t* result
+);
+IDE_API int ide_context_search_to_coordinate(
+    ide_context_t* context, double lng, double lat, double target_lng, double target_lat, ide_search_result_t* result
+);
+// Copy at most capacity reachable cells into cells and return the total count, pass NULL to get the count only
+IDE_API size_t ide_context_reachable_cells(const ide_context_t* context, ide_cell_t* cells, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "s2/cell_t.hpp"
+
+namespace ingress_drone_explorer {
+
+namespace s2 {
+
+// Convert arrays of longitudes and latitudes to cells and append them to cells, in SIMD if supported by the CPU.
+void cells_of(
+    const double* lngs, const double* lats, const size_t count, const uint8_t level, std::vector<cell_t>& cells
+);
+
+// Scalar reference of cells_of, the results should be bit-exact identical.
+void cells_of_reference(
+    const double* lngs, const double* lats, const size_t count, const uint8_t level, std::vector<cell_t>& cells
+);
+
+} // namespace s2
+
+} // namespace ingress_drone_explorer
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdint>
 #include <set>
 
-namespace ingress_drone_explorer {
+#include "s2/ecef_coordinate_t.hpp"
 
-struct coordinate_t;
+namespace ingress_drone_explorer {
 
 namespace s2 {
 
@@ -23,6 +25,7 @@ public:
     inline auto operator<=>(const cell_t& other) const = default;
 
 public:
+    double distance_to(const coordinate_t& center) const;
     bool intersects_with_cap_of(const coordinate_t& center, const double radius) const;
     std::set<cell_t> neighbored_cells_covering_cap_of(const coordinate_t& center, const double radius) const;
     std::set<cell_t> neighbored_cells_in(const int32_t rounds) const;
@@ -31,9 +34,25 @@ public:
 private:
 
     inline coordinate_t coordinate(const double d_i, const double d_j) const;
+    inline std::array<coordinate_t, 4> closest_corners_to(const coordinate_t& center) const;
     inline std::set<cell_t> neighbors() const;
 };
 
+inline cell_t::cell_t(const uint8_t face, const int32_t i, const int32_t j, uint8_t level) {
+    _level = level;
+    const int32_t max = 1 << level;
+    if (i >= 0 && j >= 0 && i < max && j < max) {
+        _face = face;
+        _i = i;
+        _j = j;
+        return;
+    }
+    double s, t;
+    ecef_coordinate_t(face, (0.5 + i) / max, (0.5 + j) / max).face_s_t(_face, s, t);
+    _i = std::clamp(static_cast<decltype(_i)>(std::floor(s * max)), 0, max - 1);
+    _j = std::clamp(static_cast<decltype(_j)>(std::floor(t * max)), 0, max - 1);
+}
+
 } // namespace s2
 
 } // namespace ingress_drone_explorer
\ No newline at end of file
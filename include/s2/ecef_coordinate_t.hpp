@@ -1,10 +1,12 @@
 #pragma once
 
 #include <array>
+#include <cmath>
 #include <functional>
 #include <set>
 
 #include "definitions/coordinate_t.hpp"
+#include "s2/trigonometry.hpp"
 
 namespace ingress_drone_explorer {
 
@@ -16,12 +18,11 @@ struct ecef_coordinate_t {
     double _z;
 
     inline ecef_coordinate_t(const coordinate_t& coordinate) {
-        const auto theta = coordinate.theta();
-        const auto phi = coordinate.phi();
-        const auto cos_phi = std::cos(phi);
-        _x = std::cos(theta) * cos_phi;
-        _y = std::sin(theta) * cos_phi;
-        _z = std::sin(phi);
+        double sin_theta, cos_theta, cos_phi;
+        sin_cos(coordinate.theta(), sin_theta, cos_theta);
+        sin_cos(coordinate.phi(), _z, cos_phi);
+        _x = cos_theta * cos_phi;
+        _y = sin_theta * cos_phi;
     }
 
     inline ecef_coordinate_t(const uint8_t face, const double s, const double t) {
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+namespace ingress_drone_explorer {
+
+namespace s2 {
+
+// Polynomial sine and cosine shared by the scalar and SIMD projections, every step is reproduced lane by lane in
+// s2/batch.cpp so both produce bit-exact identical results.
+namespace trigonometry {
+
+// 1.5 * 2^52, adding it rounds to integer and leaves the integer in the low bits of the mantissa
+static constexpr double _round_shift = 6755399441055744.0;
+static constexpr double _2_over_pi = 6.36619772367581382433e-01;
+// Cody-Waite split of pi / 2, the first two parts have 33 bits so multiplying them by a small quadrant is exact
+static constexpr double _pi_over_2_1 = 1.57079632673412561417e+00;
+static constexpr double _pi_over_2_2 = 6.07710050630396597660e-11;
+static constexpr double _pi_over_2_2t = 2.02226624879595063154e-21;
+
+// Minimax coefficients on [-pi / 4, pi / 4] from fdlibm
+static constexpr double _s1 = -1.66666666666666324348e-01;
+static constexpr double _s2 = 8.33333333332248946124e-03;
+static constexpr double _s3 = -1.98412698298579493134e-04;
+static constexpr double _s4 = 2.75573137070700676789e-06;
+static constexpr double _s5 = -2.50507602534068634195e-08;
+static constexpr double _s6 = 1.58969099521155010221e-10;
+
+static constexpr double _c1 = 4.16666666666666019037e-02;
+static constexpr double _c2 = -1.38888888888741095749e-03;
+static constexpr double _c3 = 2.48015872894767294178e-05;
+static constexpr double _c4 = -2.75573143513906633035e-07;
+static constexpr double _c5 = 2.08757232129817482790e-09;
+static constexpr double _c6 = -1.13596475577881948265e-11;
+
+} // namespace trigonometry
+
+// Accurate to about 1 ulp for |x| much less than 2^20, which covers all the longitudes and latitudes in radians.
+inline void sin_cos(const double x, double& sin, double& cos) {
+    using namespace trigonometry;
+
+    const auto shifted = x * _2_over_pi + _round_shift;
+    const auto q = shifted - _round_shift;
+    const auto r = ((x - q * _pi_over_2_1) - q * _pi_over_2_2) - q * _pi_over_2_2t;
+
+    const auto z = r * r;
+    const auto v = z * r;
+    const auto s = r + v * (_s1 + z * (_s2 + z * (_s3 + z * (_s4 + z * (_s5 + z * _s6)))));
+    const auto w = z * z;
+    const auto p = z * (_c1 + z * (_c2 + z * _c3)) + w * w * (_c4 + z * (_c5 + z * _c6));
+    const auto h = 0.5 * z;
+    const auto one_h = 1.0 - h;
+    const auto c = one_h + (((1.0 - one_h) - h) + z * p);
+
+    const auto quadrant = std::bit_cast<uint64_t>(shifted);
+    sin = (quadrant & 1) ? c : s;
+    cos = (quadrant & 1) ? s : c;
+    if (quadrant & 2) {
+        sin = -sin;
+    }
+    if ((quadrant + 1) & 2) {
+        cos = -cos;
+    }
+}
+
+} // namespace s2
+
+} // namespace ingress_drone_explorer
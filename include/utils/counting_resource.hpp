@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <string>
+
+namespace ingress_drone_explorer {
+
+// Thrown when an allocation would exceed the memory limit, before the system runs out of memory.
+class memory_limit_error : public std::bad_alloc {
+public:
+    inline explicit memory_limit_error(std::string message) : _message(std::move(message)) { }
+
+    inline const char* what() const noexcept override {
+        return _message.c_str();
+    }
+
+private:
+    std::string _message;
+};
+
+// Bytes and peak of a counter, safe to update from threads.
+class memory_counter_t {
+public:
+    inline size_t bytes() const {
+        return _bytes.load(std::memory_order_relaxed);
+    }
+
+    inline size_t peak() const {
+        return _peak.load(std::memory_order_relaxed);
+    }
+
+    inline void reset_peak() {
+        _peak.store(bytes(), std::memory_order_relaxed);
+    }
+
+    // Returns the bytes after adding
+    inline size_t add(const size_t bytes) {
+        const auto current = _bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        auto peak = _peak.load(std::memory_order_relaxed);
+        while (current > peak && !_peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) { }
+        return current;
+    }
+
+    inline void subtract(const size_t bytes) {
+        _bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<size_t> _bytes = 0;
+    std::atomic<size_t> _peak = 0;
+};
+
+// Counts the bytes allocated for one structure and charges them to a total shared with the other structures, which
+// is checked against the limit if any.
+class counting_resource_t : public std::pmr::memory_resource {
+public:
+    inline counting_resource_t(
+        const char* name,
+        memory_counter_t& total,
+        const size_t& limit,
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()
+    ) : _name(name), _total(total), _limit(limit), _upstream(upstream) { }
+
+    counting_resource_t(const counting_resource_t&) = delete;
+    counting_resource_t& operator=(const counting_resource_t&) = delete;
+
+public:
+    inline const char* name() const {
+        return _name;
+    }
+
+    inline const memory_counter_t& counter() const {
+        return _counter;
+    }
+
+    inline void reset_peak() {
+        _counter.reset_peak();
+    }
+
+    // Charge bytes allocated elsewhere on behalf of the structure, e.g. the heap of strings in its nodes
+    inline void charge(const size_t bytes) {
+        const auto total = _total.add(bytes);
+        if (_limit > 0 && total > _limit) {
+            _total.subtract(bytes);
+            throw memory_limit_error(
+                "🧠 Memory limit of " + std::to_string(_limit >> 20) + " MiB is exceeded by " + _name + "."
+            );
+        }
+        _counter.add(bytes);
+    }
+
+    inline void discharge(const size_t bytes) {
+        _counter.subtract(bytes);
+        _total.subtract(bytes);
+    }
+
+private:
+    inline void* do_allocate(const size_t bytes, const size_t alignment) override {
+        charge(bytes);
+        try {
+            return _upstream->allocate(bytes, alignment);
+        } catch (...) {
+            discharge(bytes);
+            throw;
+        }
+    }
+
+    inline void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) override {
+        _upstream->deallocate(pointer, bytes, alignment);
+        discharge(bytes);
+    }
+
+    inline bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    const char*                 _name;
+    memory_counter_t&           _total;
+    const size_t&               _limit;
+    std::pmr::memory_resource*  _upstream;
+    memory_counter_t            _counter;
+};
+
+} // namespace ingress_drone_explorer
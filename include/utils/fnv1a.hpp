@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ingress_drone_explorer {
+
+// 64-bit FNV-1a, fast and stable across runs and platforms of the same byte order
+class fnv1a_t {
+public:
+    template<typename T>
+    inline void update(const T& value) {
+        update(&value, sizeof(T));
+    }
+
+    // Including the terminator so adjacent strings never collide by concatenation
+    inline void update(const std::string& value) {
+        update(value.data(), value.size() + 1);
+    }
+
+    inline void update(const void* data, const size_t size) {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        for (size_t index = 0; index < size; ++index) {
+            _value = (_value ^ bytes[index]) * 0x100000001b3;
+        }
+    }
+
+    inline uint64_t value() const {
+        return _value;
+    }
+
+private:
+    uint64_t _value = 0xcbf29ce484222325;
+};
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ingress_drone_explorer {
+
+// Bounded lock-free queue for multiple producers and consumers, based on the one by Dmitry Vyukov
+template<typename T, size_t capacity>
+class ring_buffer_t {
+    static_assert(capacity >= 2 && (capacity & (capacity - 1)) == 0, "Capacity should be a power of 2.");
+
+public:
+    inline ring_buffer_t() : _slots(std::make_unique<slot_t[]>(capacity)) {
+        for (size_t index = 0; index < capacity; ++index) {
+            _slots[index]._sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    inline bool try_push(T&& value) {
+        auto position = _enqueue_position.load(std::memory_order_relaxed);
+        while (true) {
+            auto& slot = _slots[position & (capacity - 1)];
+            const auto sequence = slot._sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0) {
+                if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot._value = std::move(value);
+                    slot._sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                // Full
+                return false;
+            } else {
+                position = _enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    inline bool try_pop(T& value) {
+        auto position = _dequeue_position.load(std::memory_order_relaxed);
+        while (true) {
+            auto& slot = _slots[position & (capacity - 1)];
+            const auto sequence = slot._sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if (difference == 0) {
+                if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(slot._value);
+                    slot._sequence.store(position + capacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                // Empty
+                return false;
+            } else {
+                position = _dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct slot_t {
+        std::atomic<size_t> _sequence;
+        T                   _value;
+    };
+
+    std::unique_ptr<slot_t[]>       _slots;
+    alignas(64) std::atomic<size_t> _enqueue_position = 0;
+    alignas(64) std::atomic<size_t> _dequeue_position = 0;
+};
+
+} // namespace ingress_drone_explorer
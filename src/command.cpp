@@ -4,14 +4,17 @@
 
 #include <boost/program_options.hpp>
 
+#include "events/channel_t.hpp"
 #include "extensions/iostream_extensions.hpp"
-#include "explorer/explorer_t.hpp"
+#include "extensions/validate.hpp"
+#include "command/explorer_t.hpp"
 
 namespace ingress_drone_explorer {
 
 void command::execute(const int argc, const char* const argv[]) {
     std::vector<std::string> portal_list_filenames;
     coordinate_t start;
+    std::string format;
 
     boost::program_options::options_description options;
     options.add_options()
@@ -25,8 +28,61 @@ void command::execute(const int argc, const char* const argv[]) {
             boost::program_options::value<coordinate_t>(&start)->required(),
             "The starting point."
         )
+        (
+            "target,t",
+            boost::program_options::value<std::string>(),
+            "GUID or coordinate (longitude,latitude) of the target to search a path to, instead of exploring all."
+        )
         ("key-list,k", boost::program_options::value<std::string>(), "Path of key list file.")
+        (
+            "visible-radii",
+            boost::program_options::value<std::vector<double>>()->multitoken(),
+            "Visible radii in meters to analyze reachability for, instead of exploring with the default one."
+        )
+        ("hierarchical", "Summarize parent cells before exploring, to reach connected ones at once.")
+        (
+            "checkpoint",
+            boost::program_options::value<std::string>(),
+            "Path of checkpoint file to save the exploration to periodically, removed once finished."
+        )
+        (
+            "checkpoint-interval",
+            boost::program_options::value<unsigned>()->default_value(60),
+            "Seconds between checkpoints."
+        )
+        ("resume", "Continue from the checkpoint if it matches the Portals, Keys and start.")
+        (
+            "cache",
+            boost::program_options::value<std::string>(),
+            "Path of directory to reuse the reachable cells from, for the same Portals, Keys and start cells."
+        )
+        (
+            "cache-limit",
+            boost::program_options::value<size_t>()->default_value(64),
+            "MiB of the cache before removing the least recently used results."
+        )
+        (
+            "numa",
+            "Place the cells on the NUMA nodes by spatial ranges and pin to the node owning the start, with statistics "
+            "by node."
+        )
+        ("analyze-keys", "Analyze how many cells and Portals each Key unlocks, instead of exploring.")
+        (
+            "format",
+            boost::program_options::value<std::string>(&format)->default_value("human"),
+            "Format of the output: human, ndjson or quiet."
+        )
         ("output-drawn-items", boost::program_options::value<std::string>(), "Path of drawn items file to output.")
+        (
+            "memory-limit",
+            boost::program_options::value<size_t>(),
+            "Fail as soon as the tracked structures exceed the limit in MiB."
+        )
+        ("memory-statistics", "Report the memory used by each structure after each phase.")
+        (
+            "profile",
+            "Count cycles, instructions, cache and branch misses and page faults of each phase, only on Linux."
+        )
         ("help,h", "Show help information.");
 
     boost::program_options::positional_options_description positional_options;
@@ -45,12 +101,100 @@ void command::execute(const int argc, const char* const argv[]) {
 
     boost::program_options::notify(variables);
 
-    explorer_t explorer;
+    events::format_t channel_format;
+    if (format == "human") {
+        channel_format = events::format_t::human;
+    } else if (format == "ndjson") {
+        channel_format = events::format_t::ndjson;
+    } else if (format == "quiet") {
+        channel_format = events::format_t::quiet;
+    } else {
+        throw std::runtime_error("Invalid output format.");
+    }
+
+    if (variables.count("hierarchical")
+        && (variables.count("visible-radii") || variables.count("analyze-keys") || variables.count("target"))) {
+        throw std::runtime_error("Hierarchical exploration could not be used with other analysis or search.");
+    }
+    if (variables.count("checkpoint")
+        && (variables.count("hierarchical") || variables.count("visible-radii") || variables.count("analyze-keys")
+            || variables.count("target"))) {
+        throw std::runtime_error("Checkpoints could only be used with the flat exploration.");
+    }
+    if (variables.count("resume") && !variables.count("checkpoint")) {
+        throw std::runtime_error("Checkpoint file is required to resume.");
+    }
+    if (variables.count("cache")
+        && (variables.count("visible-radii") || variables.count("analyze-keys") || variables.count("target"))) {
+        throw std::runtime_error("Cache could only be used with the exploration.");
+    }
+
+    explorer_options_t explorer_options;
+    if (variables.count("memory-limit")) {
+        explorer_options._memory_limit = variables["memory-limit"].as<size_t>() << 20;
+        if (explorer_options._memory_limit == 0) {
+            throw std::runtime_error("Invalid memory limit.");
+        }
+    }
+    explorer_options._memory_statistics = variables.count("memory-statistics") > 0;
+    explorer_options._profile = variables.count("profile") > 0;
+
+    events::channel_t channel(channel_format);
+    explorer_t explorer(channel, explorer_options);
     explorer.load_portals(portal_list_filenames);
     if (variables.count("key-list")) {
         explorer.load_keys(variables["key-list"].as<std::string>());
     }
-    explorer.explore_from(start);
+    if (variables.count("numa")) {
+        explorer.place_on_nodes();
+        explorer.pin_to_node_of(start);
+    }
+    if (variables.count("visible-radii")) {
+        explorer.analyze_radii_from(start, variables["visible-radii"].as<std::vector<double>>());
+        return;
+    }
+    if (variables.count("analyze-keys")) {
+        if (!variables.count("key-list")) {
+            throw std::runtime_error("Key list is required to analyze Keys.");
+        }
+        explorer.analyze_keys_from(start);
+        return;
+    }
+    if (variables.count("target")) {
+        const auto& target = variables["target"].as<std::string>();
+        if (std::string::npos == target.find(',')) {
+            explorer.search_from(start, target);
+        } else {
+            coordinate_t target_coordinate;
+            if (!parse(target, target_coordinate)) {
+                throw std::runtime_error("Invalid target coordinate.");
+            }
+            explorer.search_from(start, target_coordinate);
+        }
+        return;
+    }
+    if (variables.count("hierarchical")) {
+        explorer.summarize();
+    }
+    std::optional<checkpoint_options_t> checkpoint_options;
+    if (variables.count("checkpoint")) {
+        checkpoint_options = {
+            variables["checkpoint"].as<std::string>(),
+            std::chrono::seconds(variables["checkpoint-interval"].as<unsigned>()),
+            variables.count("resume") > 0,
+        };
+    }
+    std::optional<cache_options_t> cache_options;
+    if (variables.count("cache")) {
+        cache_options = {
+            variables["cache"].as<std::string>(),
+            static_cast<uintmax_t>(variables["cache-limit"].as<size_t>()) << 20,
+        };
+    }
+    explorer.explore_from(start, checkpoint_options, cache_options);
+    if (variables.count("numa")) {
+        explorer.report_nodes();
+    }
     explorer.report();
     if (variables.count("output-drawn-items")) {
         explorer.save_drawn_items_to(variables["output-drawn-items"].as<std::string>());
@@ -0,0 +1,146 @@
+#include "command/explorer_t.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+#include <boost/json/value_from.hpp>
+
+#include "events/channel_t.hpp"
+#include "extensions/iostream_extensions.hpp"
+#include "extensions/tag_invoke.hpp"
+#include "utils/digits.hpp"
+
+namespace ingress_drone_explorer {
+
+void explorer_t::analyze_radii_from(const coordinate_t& start, const std::vector<double>& radii) {
+    if (radii.empty()) {
+        return;
+    }
+    begin_phase();
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto start_cell = s2::cell_t(start);
+    const auto max_radius = *std::max_element(radii.begin(), radii.end());
+    _channel.emit(
+        "radii_analysis_started",
+        {
+            { "start", boost::json::value_from(start) },
+            { "cell", boost::json::value_from(start_cell) },
+            { "max_radius", max_radius },
+        },
+        [&](auto& out) {
+            out
+                << "⏳ Analyze visible radii up to " << max_radius << " m "
+                << "from " << start << " in cell #" << start_cell;
+        }
+    );
+
+    const auto result = _context.analyze_radii_from(start, radii);
+
+    const auto end_time = std::chrono::steady_clock::now();
+    const auto seconds = 1E-6 * std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+    _channel.emit(
+        "radii_analysis_finished",
+        { { "seconds", seconds } },
+        [&](auto& out) { out << "🔍 Analysis finished after " << seconds << " seconds"; }
+    );
+    end_phase("radii analysis");
+
+    const auto number_digits = digits(_index.portals_count());
+    for (const auto& reachability : result) {
+        _channel.emit(
+            "radius_analyzed",
+            {
+                { "radius", reachability._radius },
+                { "reachable_cells", reachability._reachable_cells_count },
+                { "reachable_portals", reachability._reachable_portals_count },
+            },
+            [&](auto& out) {
+                out
+                    << "📡 Within " << reachability._radius << " m, "
+                    << std::setw(number_digits) << reachability._reachable_cells_count << " cell(s) and "
+                    << std::setw(number_digits) << reachability._reachable_portals_count << " Portal(s) are ✅ reachable";
+            }
+        );
+    }
+}
+
+void explorer_t::analyze_keys_from(const coordinate_t& start) {
+    begin_phase();
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto start_cell = s2::cell_t(start);
+    _channel.emit(
+        "keys_analysis_started",
+        { { "start", boost::json::value_from(start) }, { "cell", boost::json::value_from(start_cell) } },
+        [&](auto& out) { out << "⏳ Analyze Keys from " << start << " in cell #" << start_cell; }
+    );
+
+    const auto result = _context.analyze_keys_from(start);
+
+    const auto end_time = std::chrono::steady_clock::now();
+    const auto seconds = 1E-6 * std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+    _channel.emit(
+        "keys_analysis_finished",
+        { { "seconds", seconds } },
+        [&](auto& out) { out << "🔍 Analysis finished after " << seconds << " seconds"; }
+    );
+    end_phase("Key analysis");
+
+    _channel.emit(
+        "keys_analyzed",
+        {
+            { "keys", result._impacts.size() },
+            { "base_reachable_cells", result._base_reachable_cells_count },
+            { "base_reachable_portals", result._base_reachable_portals_count },
+            { "reachable_cells", result._reachable_cells_count },
+            { "reachable_portals", result._reachable_portals_count },
+        },
+        [&](auto& out) {
+            out
+                << "⬜️ Without Keys, "
+                << result._base_reachable_cells_count << " cell(s) and "
+                << result._base_reachable_portals_count << " Portal(s) are ✅ reachable"
+                << std::endl
+                << "🔑 With all " << result._impacts.size() << " Key(s), "
+                << result._reachable_cells_count << " cell(s) and "
+                << result._reachable_portals_count << " Portal(s) are ✅ reachable";
+        }
+    );
+
+    const auto number_digits = digits(result._reachable_portals_count);
+    size_t useless_keys_count = 0;
+    for (const auto& impact : result._impacts) {
+        if (impact._alone_cells_count == 0 && impact._marginal_cells_count == 0) {
+            ++useless_keys_count;
+            continue;
+        }
+        const auto& portal = impact._portal;
+        _channel.emit(
+            "key_impact",
+            {
+                { "portal", boost::json::value_from(portal) },
+                { "alone_cells", impact._alone_cells_count },
+                { "alone_portals", impact._alone_portals_count },
+                { "marginal_cells", impact._marginal_cells_count },
+                { "marginal_portals", impact._marginal_portals_count },
+            },
+            [&](auto& out) {
+                out
+                    << "  🔑 Alone +" << std::setw(number_digits) << impact._alone_cells_count << " cell(s) "
+                    << "+" << std::setw(number_digits) << impact._alone_portals_count << " Portal(s), "
+                    << "given others +" << std::setw(number_digits) << impact._marginal_cells_count << " cell(s) "
+                    << "+" << std::setw(number_digits) << impact._marginal_portals_count << " Portal(s): "
+                    << (portal._title.empty() ? "Untitled" : portal._title) << " at " << portal._coordinate;
+            }
+        );
+    }
+    if (useless_keys_count > 0) {
+        _channel.emit(
+            "useless_keys",
+            { { "keys", useless_keys_count } },
+            [&](auto& out) { out << "  💤 " << useless_keys_count << " Key(s) unlock nothing"; }
+        );
+    }
+}
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,108 @@
+#include "command/explorer_t.hpp"
+
+#include <chrono>
+#include <optional>
+
+#include <boost/json/value_from.hpp>
+
+#include "events/channel_t.hpp"
+#include "explorer/result_cache_t.hpp"
+#include "extensions/iostream_extensions.hpp"
+#include "extensions/tag_invoke.hpp"
+
+namespace ingress_drone_explorer {
+
+void explorer_t::explore_from(
+    const coordinate_t& start,
+    const std::optional<checkpoint_options_t>& checkpoint_options,
+    const std::optional<cache_options_t>& cache_options
+) {
+    begin_phase();
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto start_cell = s2::cell_t(start);
+    _channel.emit(
+        "exploration_started",
+        { { "start", boost::json::value_from(start) }, { "cell", boost::json::value_from(start_cell) } },
+        [&](auto& out) { out << "⏳ Explore from " << start << " in cell #" << start_cell; }
+    );
+
+    // Hashing all the Portals takes a while
+    const auto digest = cache_options || checkpoint_options ? _index.digest() : 0;
+    std::optional<result_cache_t> cache;
+    std::vector<s2::cell_t> start_cells;
+    if (cache_options) {
+        cache.emplace(cache_options->_directory, cache_options->_size_limit);
+        const auto cells = _context.start_cells_of(start);
+        start_cells.assign(cells.begin(), cells.end());
+        if (const auto reachable_cells = cache->find(digest, start_cells)) {
+            _context.restore(start, *reachable_cells);
+            _channel.emit(
+                "cache_hit",
+                { { "reachable_cells", reachable_cells->size() } },
+                [&](auto& out) { out << "📦 Take " << reachable_cells->size() << " reachable cell(s) from cache"; }
+            );
+            finish_exploration(start_time);
+            return;
+        }
+    }
+
+    std::optional<checkpoint_t> checkpoint;
+    double resumed_seconds = 0;
+    if (checkpoint_options) {
+        checkpoint.emplace(checkpoint_options->_filename, checkpoint_options->_interval, digest, start);
+        if (checkpoint_options->_resume && checkpoint->resume()) {
+            const auto& state = *checkpoint->resumed();
+            resumed_seconds = state._seconds;
+            _channel.emit(
+                "exploration_resumed",
+                { { "reachable_cells", state._reachable_cells.size() }, { "seconds", resumed_seconds } },
+                [&](auto& out) {
+                    out
+                        << "♻️ Resume from checkpoint with " << state._reachable_cells.size() << " cell(s) reached "
+                        << "after " << resumed_seconds << " seconds";
+                }
+            );
+        }
+    }
+
+    _context.explore_from(
+        start,
+        [&](const size_t reached, const size_t total) { _channel.progress("exploration", reached, total); },
+        checkpoint ? &*checkpoint : nullptr
+    );
+
+    if (checkpoint) {
+        checkpoint->remove();
+        const auto error = checkpoint->error();
+        if (!error.empty()) {
+            _channel.emit("checkpoint_failed", { { "error", error } }, [&](auto& out) { out << "⚠️ " << error; });
+        }
+    }
+
+    if (cache) {
+        try {
+            const auto& cells = _context.reachable_cells();
+            cache->store(digest, start_cells, { cells.begin(), cells.end() });
+        } catch (const std::exception& e) {
+            _channel.emit("cache_failed", { { "error", e.what() } }, [&](auto& out) { out << "⚠️ " << e.what(); });
+        }
+    }
+
+    finish_exploration(start_time, resumed_seconds);
+}
+
+void explorer_t::finish_exploration(
+    const std::chrono::steady_clock::time_point& start_time, const double resumed_seconds
+) const {
+    const auto end_time = std::chrono::steady_clock::now();
+    const auto seconds = resumed_seconds
+        + 1E-6 * std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+    _channel.emit(
+        "exploration_finished",
+        { { "seconds", seconds } },
+        [&](auto& out) { out << "🔍 Exploration finished after " << seconds << " seconds"; }
+    );
+    end_phase("exploration", _context.reachable_cells().size());
+}
+
+} // namespace ingress_drone_explorer
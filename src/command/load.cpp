@@ -0,0 +1,115 @@
+#include "command/explorer_t.hpp"
+
+#include <chrono>
+#include <iomanip>
+
+#include "events/channel_t.hpp"
+
+namespace ingress_drone_explorer {
+
+void explorer_t::load_portals(const std::vector<std::string>& filenames) {
+    begin_phase();
+    const auto start_time = std::chrono::steady_clock::now();
+    _channel.emit("portals_loading", { }, [&](auto& out) { out << "⏳ Loading Portals..."; });
+
+    const auto previous_portals_count = _index.portals_count();
+    const auto files_count = _index.load_portals(filenames, [&](const auto& statistics) {
+        _channel.emit(
+            "portal_file_loaded",
+            {
+                { "file", statistics._filename },
+                { "portals", statistics._portals_count },
+                { "cells", statistics._cells_count },
+            },
+            [&](auto& out) {
+                out
+                    << "  📃 Added "
+                    << std::setw(5) << statistics._portals_count
+                    << " portal(s) and "
+                    << std::setw(4) << statistics._cells_count
+                    << " cell(s) from " << statistics._filename;
+            }
+        );
+    });
+    const auto portals_count = _index.portals_count() - previous_portals_count;
+
+    const auto end_time = std::chrono::steady_clock::now();
+    const auto seconds = 1E-6 * std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+    _channel.emit(
+        "portals_loaded",
+        {
+            { "portals", portals_count },
+            { "cells", _index.cells().size() },
+            { "files", files_count },
+            { "seconds", seconds },
+        },
+        [&](auto& out) {
+            out
+                << "📍 Loaded " << portals_count << " Portal(s) "
+                << "in " << _index.cells().size() << " cell(s) "
+                << "from " << files_count << " file(s), "
+                << "which took " << seconds << " seconds";
+        }
+    );
+    end_phase("loading Portals");
+}
+
+void explorer_t::load_keys(const std::string& filename) {
+    begin_phase();
+    _channel.emit(
+        "keys_loading",
+        { { "file", filename } },
+        [&](auto& out) { out << "⏳ Loading Keys from " << filename << "..."; }
+    );
+    const auto statistics = _index.load_keys(filename);
+    const auto cells_count = _index.cells_containing_keys().size();
+    _channel.emit(
+        "keys_loaded",
+        {
+            { "keys", statistics._loaded_count },
+            { "matched", statistics._matched_count },
+            { "cells", cells_count },
+        },
+        [&](auto& out) {
+            out
+                << "🔑 Loaded " << statistics._loaded_count << " Key(s) "
+                << "and matched " << statistics._matched_count << " "
+                << "in " << cells_count << " cell(s)";
+        }
+    );
+    end_phase("loading Keys");
+}
+
+void explorer_t::summarize() {
+    begin_phase();
+    const auto start_time = std::chrono::steady_clock::now();
+    _channel.emit("summarizing", { }, [&](auto& out) { out << "⏳ Summarizing parent cells..."; });
+
+    _index.summarize();
+    size_t connected_count = 0;
+    for (const auto& entry : _index.summaries()) {
+        if (entry.second._connected) {
+            ++connected_count;
+        }
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+    const auto seconds = 1E-6 * std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+    _channel.emit(
+        "summarized",
+        {
+            { "parents", _index.summaries().size() },
+            { "connected", connected_count },
+            { "seconds", seconds },
+        },
+        [&](auto& out) {
+            out
+                << "🗺️ Summarized " << _index.summaries().size() << " parent cell(s), "
+                << connected_count << " are connected, "
+                << "which took " << seconds << " seconds";
+        }
+    );
+    end_phase("summarizing");
+}
+
+} // namespace ingress_drone_explorer
\ No newline at end of file
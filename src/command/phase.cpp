@@ -0,0 +1,145 @@
+#include "command/explorer_t.hpp"
+
+#include <iomanip>
+#include <optional>
+
+#include <boost/json.hpp>
+
+#include "events/channel_t.hpp"
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+struct mebibytes_t {
+    size_t _bytes;
+};
+
+std::ostream& operator<<(std::ostream& out, const mebibytes_t& value) {
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(1) << value._bytes / 1048576.0 << " MiB";
+    out.flags(flags);
+    out.precision(precision);
+    return out;
+}
+
+} // namespace
+
+explorer_t::explorer_t(events::channel_t& channel, const explorer_options_t& options)
+    : _channel(channel), _options(options), _index(options._memory_limit), _context(_index) {
+    if (!_options._profile) {
+        return;
+    }
+    _profiler = std::make_unique<profiler_t>();
+    if (!_profiler->error().empty()) {
+        _channel.emit(
+            "profiler_degraded",
+            { { "error", _profiler->error() } },
+            [&](auto& out) { out << "⚠️ Unavailable performance counters, " << _profiler->error(); }
+        );
+    }
+}
+
+void explorer_t::begin_phase() const {
+    _index.memory().reset_peaks();
+    if (_profiler) {
+        _profiler->start();
+    }
+}
+
+void explorer_t::end_phase(const char* phase, const size_t cells) const {
+    // Stop counting before formatting the reports
+    report_profile(phase, cells);
+    report_memory(phase);
+}
+
+void explorer_t::report_profile(const char* phase, const size_t cells) const {
+    if (!_profiler) {
+        return;
+    }
+    using counter_t = profiler_t::counter_t;
+    const auto sample = _profiler->stop();
+    boost::json::object data {
+        { "phase", phase },
+        { "seconds", sample._seconds },
+        { "cells", cells },
+    };
+    for (size_t index = 0; index < profiler_t::_counters_count; ++index) {
+        const auto& value = sample._values[index];
+        auto& item = data[profiler_t::name_of(static_cast<counter_t>(index))];
+        if (value) {
+            item = *value;
+        } else {
+            item = nullptr;
+        }
+    }
+    const auto& cycles = sample[counter_t::cycles];
+    const auto& instructions = sample[counter_t::instructions];
+    std::optional<double> ipc;
+    if (cycles && instructions && *cycles > 0) {
+        ipc = static_cast<double>(*instructions) / *cycles;
+        data["ipc"] = *ipc;
+    }
+    _channel.emit(
+        "profile_reported",
+        std::move(data),
+        [&](auto& out) {
+            out << "📊 Profile of " << phase << " in " << sample._seconds << " seconds";
+            if (ipc) {
+                out << ", IPC " << std::fixed << std::setprecision(2) << *ipc << std::defaultfloat;
+            }
+            for (size_t index = 0; index < profiler_t::_counters_count; ++index) {
+                const auto& value = sample._values[index];
+                if (!value) {
+                    continue;
+                }
+                out << std::endl << "  🔢 " << profiler_t::name_of(static_cast<counter_t>(index)) << ": " << *value;
+                if (cells > 0) {
+                    out
+                        << " (" << std::setprecision(3) << static_cast<double>(*value) / cells
+                        << std::setprecision(6) << " per cell)";
+                }
+            }
+        }
+    );
+}
+
+void explorer_t::report_memory(const char* phase) const {
+    if (!_options._memory_statistics) {
+        return;
+    }
+    const auto& memory = _index.memory();
+    boost::json::object structures;
+    for (const auto* resource : memory.resources()) {
+        structures[resource->name()] = boost::json::object {
+            { "bytes", resource->counter().bytes() },
+            { "peak", resource->counter().peak() },
+        };
+    }
+    _channel.emit(
+        "memory_reported",
+        {
+            { "phase", phase },
+            { "bytes", memory._total.bytes() },
+            { "peak", memory._total.peak() },
+            { "structures", std::move(structures) },
+        },
+        [&](auto& out) {
+            out
+                << "🧠 Memory of " << phase << " peaked at " << mebibytes_t { memory._total.peak() }
+                << ", " << mebibytes_t { memory._total.bytes() } << " in use";
+            for (const auto* resource : memory.resources()) {
+                if (resource->counter().peak() == 0) {
+                    continue;
+                }
+                out
+                    << std::endl
+                    << "  🧱 " << resource->name() << " peaked at " << mebibytes_t { resource->counter().peak() }
+                    << ", " << mebibytes_t { resource->counter().bytes() } << " in use";
+            }
+        }
+    );
+}
+
+} // namespace ingress_drone_explorer
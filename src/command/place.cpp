@@ -0,0 +1,97 @@
+#include "command/explorer_t.hpp"
+
+#include <iomanip>
+
+#include <boost/json.hpp>
+
+#include "events/channel_t.hpp"
+#include "explorer/numa_t.hpp"
+
+namespace ingress_drone_explorer {
+
+void explorer_t::place_on_nodes() {
+    begin_phase();
+    const auto statistics = _index.place_on_nodes();
+    const auto bound = _index.memory()._placement.bound();
+    boost::json::array nodes;
+    for (size_t node = 0; node < statistics.size(); ++node) {
+        nodes.push_back(boost::json::object {
+            { "node", numa_t::topology().nodes()[node]._id },
+            { "cells", statistics[node]._cells_count },
+            { "portals", statistics[node]._portals_count },
+            { "bytes", statistics[node]._bytes },
+        });
+    }
+    _channel.emit(
+        "nodes_placed",
+        { { "nodes", std::move(nodes) }, { "bound", bound } },
+        [&](auto& out) {
+            out << "🧭 Placed the cells on " << statistics.size() << " NUMA node(s)";
+            if (!bound) {
+                out << " by the first touch, binding is denied";
+            }
+            for (size_t node = 0; node < statistics.size(); ++node) {
+                out
+                    << std::endl
+                    << "  🗄️ Node " << numa_t::topology().nodes()[node]._id << ": "
+                    << statistics[node]._cells_count << " cell(s) and "
+                    << statistics[node]._portals_count << " Portal(s) in "
+                    << std::fixed << std::setprecision(1) << statistics[node]._bytes / 1048576.0 << " MiB"
+                    << std::defaultfloat << std::setprecision(6);
+            }
+        }
+    );
+    end_phase("placing on nodes", _index.cells().size());
+}
+
+void explorer_t::pin_to_node_of(const coordinate_t& start) {
+    _node = _index.node_of(s2::cell_t(start));
+    const auto id = numa_t::topology().nodes()[_node]._id;
+    const auto pinned = numa_t::topology().pin_to(_node);
+    _channel.emit(
+        "thread_pinned",
+        { { "node", id }, { "pinned", pinned } },
+        [&](auto& out) {
+            if (pinned) {
+                out << "📌 Pinned to node " << id << " owning the start";
+            } else {
+                out << "⚠️ Unable to pin to node " << id << " owning the start";
+            }
+        }
+    );
+}
+
+void explorer_t::report_nodes() const {
+    const auto& nodes_topology = numa_t::topology().nodes();
+    std::vector<size_t> reachable_cells(nodes_topology.size());
+    for (const auto& cell : _context.reachable_cells()) {
+        ++reachable_cells[_index.node_of(cell)];
+    }
+    const auto total = _context.reachable_cells().size();
+    // Share of the reached cells in the memory of the exploring thread
+    const auto local_ratio = total > 0 ? static_cast<double>(reachable_cells[_node]) / total : 1.0;
+    boost::json::array nodes;
+    for (size_t node = 0; node < nodes_topology.size(); ++node) {
+        nodes.push_back(boost::json::object {
+            { "node", nodes_topology[node]._id },
+            { "reachable_cells", reachable_cells[node] },
+        });
+    }
+    _channel.emit(
+        "nodes_reached",
+        { { "nodes", std::move(nodes) }, { "local_ratio", local_ratio } },
+        [&](auto& out) {
+            out
+                << "🧭 " << std::fixed << std::setprecision(1) << local_ratio * 100
+                << std::defaultfloat << std::setprecision(6) << "% of the reachable cells are local to node "
+                << nodes_topology[_node]._id;
+            for (size_t node = 0; node < nodes_topology.size(); ++node) {
+                out
+                    << std::endl
+                    << "  🗄️ Node " << nodes_topology[node]._id << ": " << reachable_cells[node] << " reachable cell(s)";
+            }
+        }
+    );
+}
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,133 @@
+#include "command/profiler_t.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#   include <linux/perf_event.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+#if defined(__linux__)
+
+struct event_t {
+    uint32_t _type;
+    uint64_t _config;
+};
+
+constexpr std::array<event_t, profiler_t::_counters_count> _events {
+    event_t { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    event_t { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    event_t { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    event_t { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    event_t { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+};
+
+int open_event(const event_t& event) {
+    perf_event_attr attribute;
+    std::memset(&attribute, 0, sizeof(attribute));
+    attribute.size = sizeof(attribute);
+    attribute.type = event._type;
+    attribute.config = event._config;
+    attribute.disabled = 1;
+    attribute.exclude_kernel = 1;
+    attribute.exclude_hv = 1;
+    // Count the threads created later too, e.g. the parser
+    attribute.inherit = 1;
+    attribute.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attribute, 0, -1, -1, 0));
+}
+
+#endif
+
+} // namespace
+
+profiler_t::profiler_t() {
+    _descriptors.fill(-1);
+#if defined(__linux__)
+    for (size_t index = 0; index < _counters_count; ++index) {
+        _descriptors[index] = open_event(_events[index]);
+        if (_descriptors[index] < 0) {
+            if (!_error.empty()) {
+                _error += ", ";
+            }
+            _error += name_of(static_cast<counter_t>(index));
+            _error += ": ";
+            _error += std::strerror(errno);
+        }
+    }
+#else
+    _error = "Performance counters are only supported on Linux";
+#endif
+}
+
+profiler_t::~profiler_t() {
+#if defined(__linux__)
+    for (const auto descriptor : _descriptors) {
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+    }
+#endif
+}
+
+const char* profiler_t::name_of(const counter_t counter) {
+    switch (counter) {
+    case counter_t::cycles:
+        return "cycles";
+    case counter_t::instructions:
+        return "instructions";
+    case counter_t::cache_misses:
+        return "cache_misses";
+    case counter_t::branch_misses:
+        return "branch_misses";
+    case counter_t::page_faults:
+        return "page_faults";
+    }
+    return "";
+}
+
+void profiler_t::start() {
+#if defined(__linux__)
+    for (const auto descriptor : _descriptors) {
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+    _start_time = std::chrono::steady_clock::now();
+}
+
+profiler_t::sample_t profiler_t::stop() {
+    sample_t sample;
+    const auto end_time = std::chrono::steady_clock::now();
+    sample._seconds = 1E-6 * std::chrono::duration_cast<std::chrono::microseconds>(end_time - _start_time).count();
+#if defined(__linux__)
+    for (size_t index = 0; index < _counters_count; ++index) {
+        const auto descriptor = _descriptors[index];
+        if (descriptor < 0) {
+            continue;
+        }
+        ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+        // Value, time enabled and time running
+        uint64_t values[3] = { };
+        if (read(descriptor, values, sizeof(values)) != sizeof(values) || values[2] == 0) {
+            continue;
+        }
+        // Scale if multiplexed with other events
+        sample._values[index] = values[2] < values[1]
+            ? static_cast<uint64_t>(static_cast<double>(values[0]) * values[1] / values[2])
+            : values[0];
+    }
+#endif
+    return sample;
+}
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,164 @@
+#include "command/explorer_t.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <memory_resource>
+
+#include <boost/json.hpp>
+
+#include "definitions/drawn_item_t.hpp"
+#include "events/channel_t.hpp"
+#include "extensions/iostream_extensions.hpp"
+#include "extensions/json_resource.hpp"
+#include "extensions/tag_invoke.hpp"
+#include "utils/digits.hpp"
+
+namespace ingress_drone_explorer {
+
+void explorer_t::report() const {
+    begin_phase();
+    const auto result = _context.report();
+    end_phase("report", result._cells_count);
+    const auto& start = _context.start();
+    const auto portals_count = result._portals_count;
+    const auto reachable_portals_count = result._reachable_portals_count;
+    const auto& furthest_portal = result._furthest_portal;
+    if (reachable_portals_count == 0) {
+        _channel.emit(
+            "report",
+            {
+                { "cells", result._cells_count },
+                { "reachable_cells", result._reachable_cells_count },
+                { "portals", portals_count },
+                { "reachable_portals", reachable_portals_count },
+            },
+            [&](auto& out) {
+                out
+                    << "⛔️ There is no reachable portal in "
+                    << portals_count
+                    << " portal(s) from "
+                    << start;
+            }
+        );
+        return;
+    }
+    const auto furthest_distance = result._furthest_distance;
+    boost::json::array furthest_portals;
+    for (const auto& item : result._furthest_portals) {
+        furthest_portals.push_back(
+            boost::json::object { { "portal", boost::json::value_from(item._portal) }, { "distance", item._distance } }
+        );
+    }
+    _channel.emit(
+        "report",
+        {
+            { "cells", result._cells_count },
+            { "reachable_cells", result._reachable_cells_count },
+            { "portals", portals_count },
+            { "reachable_portals", reachable_portals_count },
+            { "furthest_portal", boost::json::value_from(furthest_portal) },
+            { "furthest_distance", furthest_distance },
+            { "furthest_portals", std::move(furthest_portals) },
+            { "distance_bin_width", report_t::_distance_bin_width },
+            { "distance_histogram", boost::json::value_from(result._distance_histogram) },
+            { "depth_histogram", boost::json::value_from(result._depth_histogram) },
+        },
+        [&](auto& out) {
+            const auto total_number_digits = digits(portals_count);
+            const auto reachable_number_digits = digits(reachable_portals_count);
+            const auto unreachable_number_digits = digits(portals_count - reachable_portals_count);
+            out
+                << "⬜️ In "
+                << std::setw(total_number_digits) << result._cells_count
+                << "   cell(s), "
+                << std::setw(reachable_number_digits) << result._reachable_cells_count
+                << " are ✅ reachable, "
+                << std::setw(unreachable_number_digits) << result._cells_count - result._reachable_cells_count
+                << " are ⛔️ not."
+                << std::endl;
+            out
+                << "📍 In "
+                << std::setw(total_number_digits) << portals_count
+                << " Portal(s), "
+                << std::setw(reachable_number_digits) << reachable_portals_count
+                << " are ✅ reachable, "
+                << std::setw(unreachable_number_digits) << portals_count - reachable_portals_count
+                << " are ⛔️ not."
+                << std::endl;
+            out
+                << "🛬 The furthest Portal is "
+                << (furthest_portal._title.empty() ? "Untitled" : furthest_portal._title)
+                << "." << std::endl
+                << "  📍 It's located at " << furthest_portal._coordinate << std::endl
+                << "  📏 Where is " << furthest_distance / 1000 << " km away" << std::endl
+                << "  🔗 Check it out: https://intel.ingress.com/?pll="
+                    << furthest_portal._coordinate._lat << "," << furthest_portal._coordinate._lng;
+            if (result._furthest_portals.size() > 1) {
+                out << std::endl << "🛫 The next furthest Portal(s) are";
+                const auto rank_digits = digits(result._furthest_portals.size());
+                for (size_t index = 1; index < result._furthest_portals.size(); ++index) {
+                    const auto& item = result._furthest_portals[index];
+                    out
+                        << std::endl
+                        << "  " << std::setw(rank_digits) << index + 1 << ". "
+                        << (item._portal._title.empty() ? "Untitled" : item._portal._title)
+                        << " at " << item._portal._coordinate << ", " << item._distance / 1000 << " km away";
+                }
+            }
+            const auto bin_width = report_t::_distance_bin_width / 1000;
+            const auto bin_digits = digits(static_cast<size_t>(bin_width * result._distance_histogram.size()));
+            out << std::endl << "📊 Reachable Portal(s) by distance";
+            for (size_t index = 0; index < result._distance_histogram.size(); ++index) {
+                out
+                    << std::endl
+                    << "  " << std::setw(bin_digits) << bin_width * index
+                    << " - " << std::setw(bin_digits) << bin_width * (index + 1) << " km: "
+                    << std::setw(reachable_number_digits) << result._distance_histogram[index];
+            }
+            const auto& depths = result._depth_histogram;
+            if (!depths.empty()) {
+                const auto widest = std::max_element(depths.begin(), depths.end());
+                out
+                    << std::endl
+                    << "🪜 Reached in " << depths.size() - 1 << " hop(s) from the start cell(s), the most at hop "
+                    << widest - depths.begin() << " with " << *widest << " cell(s)";
+            }
+        }
+    );
+}
+
+void explorer_t::save_drawn_items_to(const std::string& filename) const {
+    begin_phase();
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        throw std::runtime_error("Unable to open drawn items file.");
+    }
+    const auto& cells = _index.cells();
+    const auto& reachable_cells = _context.reachable_cells();
+    auto& memory = _index.memory();
+    std::pmr::vector<drawn_item_t> items(&memory._drawn_items);
+    items.reserve(cells.size());
+    std::transform(
+        cells.begin(), cells.end(),
+        std::back_inserter(items),
+        [&](const auto& entry) -> drawn_item_t {
+            const auto shape = entry.first.shape();
+            return {
+                reachable_cells.contains(entry.first) ? "#783cbd" : "#404040",
+                { shape.begin(), shape.end() }
+            };
+        }
+    );
+    json_resource_t resource(memory._json);
+    const auto value = boost::json::value_from(items, &resource);
+    out << value;
+    _channel.emit(
+        "drawn_items_saved",
+        { { "file", filename } },
+        [&](auto& out) { out << "💾 Saved drawn items to " << filename; }
+    );
+    end_phase("saving drawn items");
+}
+
+} // namespace ingress_drone_explorer
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "command/explorer_t.hpp"
+
+#include <chrono>
+
+#include <boost/json.hpp>
+
+#include "events/channel_t.hpp"
+#include "extensions/iostream_extensions.hpp"
+#include "extensions/tag_invoke.hpp"
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+inline const std::string& title_of(const portal_t& portal) {
+    static const std::string untitled = "Untitled";
+    return portal._title.empty() ? untitled : portal._title;
+}
+
+} // namespace
+
+void explorer_t::search_from(const coordinate_t& start, const coordinate_t& target) {
+    const auto target_cell = s2::cell_t(target);
+    if (!_index.cells().contains(target_cell)) {
+        throw std::runtime_error("There is no Portal in the target cell.");
+    }
+    search_from(start, target_cell, target);
+}
+
+void explorer_t::search_from(const coordinate_t& start, const std::string& target_guid) {
+    const auto portal = _index.find(target_guid);
+    if (!portal) {
+        throw std::runtime_error("Unable to find the target Portal.");
+    }
+    search_from(start, s2::cell_t(portal->_coordinate), portal->_coordinate);
+}
+
+void explorer_t::search_from(const coordinate_t& start, const s2::cell_t& target_cell, const coordinate_t& target) {
+    begin_phase();
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto start_cell = s2::cell_t(start);
+    _channel.emit(
+        "search_started",
+        {
+            { "start", boost::json::value_from(start) },
+            { "cell", boost::json::value_from(start_cell) },
+            { "target", boost::json::value_from(target) },
+            { "target_cell", boost::json::value_from(target_cell) },
+        },
+        [&](auto& out) {
+            out
+                << "⏳ Search from " << start << " in cell #" << start_cell
+                << " to " << target << " in cell #" << target_cell;
+        }
+    );
+
+    const auto result = _context.search_from(start, target_cell, target);
+
+    const auto end_time = std::chrono::steady_clock::now();
+    const auto seconds = 1E-6 * std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+    const auto discovered_cells_count = result._discovered_cells_count;
+    _channel.emit(
+        "search_finished",
+        { { "seconds", seconds }, { "discovered_cells", discovered_cells_count } },
+        [&](auto& out) {
+            out
+                << "🔍 Search finished after " << seconds << " seconds, "
+                << discovered_cells_count << " cell(s) discovered";
+        }
+    );
+    end_phase("search", discovered_cells_count);
+
+    if (!result._found) {
+        _channel.emit(
+            "target_unreachable",
+            { },
+            [&](auto& out) { out << "⛔️ The target is not reachable from " << start; }
+        );
+        return;
+    }
+
+    const auto& path = result._hops;
+    boost::json::array hops_value;
+    for (const auto& hop : path) {
+        boost::json::object hop_value {
+            { "cell", boost::json::value_from(hop._cell) },
+            { "portal", boost::json::value_from(hop._portal) },
+        };
+        if (hop._key) {
+            hop_value["key"] = boost::json::value_from(*hop._key);
+        }
+        hops_value.push_back(std::move(hop_value));
+    }
+    _channel.emit(
+        "target_reached",
+        { { "hops", std::move(hops_value) }, { "target_cell", boost::json::value_from(target_cell) } },
+        [&](auto& out) {
+            out << "🛬 The target is ✅ reachable in " << path.size() << " hop(s)" << std::endl;
+            for (const auto& hop : path) {
+                out
+                    << "  🛸 From " << title_of(hop._portal)
+                    << " at " << hop._portal._coordinate
+                    << " in cell #" << hop._cell;
+                if (hop._key) {
+                    out << " with 🔑 Key of " << title_of(*hop._key) << " at " << hop._key->_coordinate;
+                }
+                out << std::endl;
+            }
+            out << "  🎯 Arrive at cell #" << target_cell;
+        }
+    );
+}
+
+} // namespace ingress_drone_explorer
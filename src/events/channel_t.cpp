@@ -0,0 +1,112 @@
+#include "events/channel_t.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+
+#include <boost/json.hpp>
+
+#include "utils/digits.hpp"
+
+namespace ingress_drone_explorer {
+
+namespace events {
+
+channel_t::channel_t(const format_t format)
+    : _format(format) {
+    if (_format != format_t::quiet) {
+        _writer = std::jthread([this](std::stop_token stop_token) { write(stop_token); });
+    }
+}
+
+channel_t::~channel_t() {
+    if (_writer.joinable()) {
+        _writer.request_stop();
+        _writer.join();
+    }
+}
+
+void channel_t::emit(const char* name, boost::json::object&& data, const printer_t& print) {
+    entry_t entry;
+    switch (_format) {
+    case format_t::human: {
+        std::ostringstream out;
+        print(out);
+        entry._line = out.str();
+        break;
+    }
+    case format_t::ndjson:
+        data["event"] = name;
+        entry._line = boost::json::serialize(data);
+        break;
+    case format_t::quiet:
+        return;
+    }
+    // Messages should never be dropped
+    while (!_buffer.try_push(std::move(entry))) {
+        std::this_thread::yield();
+    }
+}
+
+void channel_t::write(std::stop_token stop_token) {
+    auto previous_progress_time = std::chrono::steady_clock::now();
+    entry_t entry;
+    while (true) {
+        // Check before draining so nothing emitted before the stop request is lost
+        const auto stopping = stop_token.stop_requested();
+        bool written = false;
+        while (_buffer.try_pop(entry)) {
+            if (!entry._phase) {
+                std::cout << entry._line << '\n';
+                written = true;
+                continue;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            if (now - previous_progress_time > _progress_interval) {
+                write_progress(entry);
+                written = true;
+                previous_progress_time = now;
+            }
+        }
+        if (written) {
+            std::cout.flush();
+        }
+        if (stopping) {
+            break;
+        }
+        std::this_thread::sleep_for(_idle_interval);
+    }
+}
+
+void channel_t::write_progress(const entry_t& entry) const {
+    if (_format == format_t::ndjson) {
+        std::cout
+            << boost::json::serialize(boost::json::object {
+                { "event", "progress" },
+                { "phase", entry._phase },
+                { "done", entry._done },
+                { "total", entry._total },
+            })
+            << '\n';
+        return;
+    }
+    const auto phase = std::string_view(entry._phase);
+    if (phase == "exploration") {
+        std::cout
+            << "⏳ Reached "
+            << std::setw(digits(entry._total)) << entry._done
+            << " / " << entry._total << " cell(s)"
+            << '\n';
+        return;
+    }
+    std::cout
+        << "⏳ " << phase << ": "
+        << std::setw(digits(entry._total)) << entry._done
+        << " / " << entry._total
+        << '\n';
+}
+
+} // namespace events
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,447 @@
+#include "explorer/async_reader_t.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#   include <io.h>
+#else
+#   include <unistd.h>
+#endif
+
+#if defined(INGRESS_DRONE_EXPLORER_IO_URING)
+#   include <linux/io_uring.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#endif
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+int open_file(const std::string& filename) {
+#if defined(_WIN32)
+    return _open(filename.c_str(), _O_RDONLY | _O_BINARY);
+#else
+    return open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+#endif
+}
+
+void close_file(const int descriptor) {
+#if defined(_WIN32)
+    _close(descriptor);
+#else
+    close(descriptor);
+#endif
+}
+
+uint64_t size_of(const int descriptor) {
+#if defined(_WIN32)
+    struct _stat64 status;
+    return _fstat64(descriptor, &status) == 0 ? status.st_size : 0;
+#else
+    struct stat status;
+    return fstat(descriptor, &status) == 0 ? status.st_size : 0;
+#endif
+}
+
+// Only one thread reads at a time, so seeking is fine where pread is missing
+int64_t read_at(const int descriptor, const uint64_t offset, char* data, const size_t length) {
+#if defined(_WIN32)
+    if (_lseeki64(descriptor, offset, SEEK_SET) < 0) {
+        return -errno;
+    }
+    const auto result = _read(descriptor, data, static_cast<unsigned>(length));
+#else
+    const auto result = pread(descriptor, data, length, offset);
+#endif
+    return result < 0 ? -errno : result;
+}
+
+} // namespace
+
+#if defined(INGRESS_DRONE_EXPLORER_IO_URING)
+
+// Rings mapped from the kernel by the raw system calls, only one thread submits and reaps
+struct async_reader_t::ring_t {
+    int             _descriptor = -1;
+    void*           _sq_ring = MAP_FAILED;
+    size_t          _sq_ring_size = 0;
+    void*           _cq_ring = MAP_FAILED;
+    size_t          _cq_ring_size = 0;
+    io_uring_sqe*   _sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t          _sqes_size = 0;
+
+    unsigned*       _sq_tail = nullptr;
+    unsigned*       _sq_mask = nullptr;
+    unsigned*       _sq_array = nullptr;
+    unsigned*       _cq_head = nullptr;
+    unsigned*       _cq_tail = nullptr;
+    unsigned*       _cq_mask = nullptr;
+    io_uring_cqe*   _cqes = nullptr;
+
+    // Leave the descriptor negative if unavailable, e.g. old kernels or denied in containers
+    explicit ring_t(const unsigned entries) {
+        io_uring_params parameters;
+        std::memset(&parameters, 0, sizeof(parameters));
+        _descriptor = static_cast<int>(syscall(__NR_io_uring_setup, entries, &parameters));
+        if (_descriptor < 0) {
+            return;
+        }
+        _sq_ring_size = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+        _cq_ring_size = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+        const bool single_map = parameters.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_map) {
+            _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+        }
+        _sq_ring = mmap(
+            nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _descriptor, IORING_OFF_SQ_RING
+        );
+        _cq_ring = single_map ? _sq_ring : mmap(
+            nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _descriptor, IORING_OFF_CQ_RING
+        );
+        _sqes_size = parameters.sq_entries * sizeof(io_uring_sqe);
+        _sqes = static_cast<io_uring_sqe*>(mmap(
+            nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _descriptor, IORING_OFF_SQES
+        ));
+        if (MAP_FAILED == _sq_ring || MAP_FAILED == _cq_ring || MAP_FAILED == _sqes) {
+            release();
+            return;
+        }
+        auto* sq_ring = static_cast<char*>(_sq_ring);
+        _sq_tail = reinterpret_cast<unsigned*>(sq_ring + parameters.sq_off.tail);
+        _sq_mask = reinterpret_cast<unsigned*>(sq_ring + parameters.sq_off.ring_mask);
+        _sq_array = reinterpret_cast<unsigned*>(sq_ring + parameters.sq_off.array);
+        auto* cq_ring = static_cast<char*>(_cq_ring);
+        _cq_head = reinterpret_cast<unsigned*>(cq_ring + parameters.cq_off.head);
+        _cq_tail = reinterpret_cast<unsigned*>(cq_ring + parameters.cq_off.tail);
+        _cq_mask = reinterpret_cast<unsigned*>(cq_ring + parameters.cq_off.ring_mask);
+        _cqes = reinterpret_cast<io_uring_cqe*>(cq_ring + parameters.cq_off.cqes);
+    }
+
+    ~ring_t() {
+        release();
+    }
+
+    void release() {
+        if (MAP_FAILED != _sqes) {
+            munmap(_sqes, _sqes_size);
+        }
+        if (MAP_FAILED != _cq_ring && _cq_ring != _sq_ring) {
+            munmap(_cq_ring, _cq_ring_size);
+        }
+        if (MAP_FAILED != _sq_ring) {
+            munmap(_sq_ring, _sq_ring_size);
+        }
+        _sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+        _cq_ring = _sq_ring = MAP_FAILED;
+        if (_descriptor >= 0) {
+            close(_descriptor);
+            _descriptor = -1;
+        }
+    }
+
+    int enter(const unsigned to_submit, const unsigned min_complete, const unsigned flags) {
+        while (true) {
+            const auto result = syscall(__NR_io_uring_enter, _descriptor, to_submit, min_complete, flags, nullptr, 0);
+            if (result >= 0 || (errno != EINTR && errno != EAGAIN && errno != EBUSY)) {
+                return static_cast<int>(result);
+            }
+        }
+    }
+
+    // The queue has as many entries as the slots, so it's never full
+    void submit(const int file, char* data, const size_t length, const uint64_t offset, const uint64_t user_data) {
+        const auto tail = *_sq_tail;
+        const auto index = tail & *_sq_mask;
+        auto& sqe = _sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = file;
+        sqe.off = offset;
+        sqe.addr = reinterpret_cast<uint64_t>(data);
+        sqe.len = static_cast<uint32_t>(length);
+        sqe.user_data = user_data;
+        _sq_array[index] = index;
+        __atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+        if (enter(1, 0, 0) < 0) {
+            throw std::runtime_error("Unable to submit read.");
+        }
+    }
+
+    // Call with each completion, block for one if none is ready
+    template<typename callback_t>
+    void reap(const bool block, const callback_t& on_completed) {
+        auto head = *_cq_head;
+        if (block && head == __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE) && enter(0, 1, IORING_ENTER_GETEVENTS) < 0) {
+            throw std::runtime_error("Unable to wait for reads.");
+        }
+        while (head != __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE)) {
+            const auto& cqe = _cqes[head & *_cq_mask];
+            on_completed(cqe.user_data, cqe.res);
+            ++head;
+        }
+        __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    }
+};
+
+#else
+
+struct async_reader_t::ring_t { };
+
+#endif
+
+async_reader_t::buffer_t::int_type async_reader_t::buffer_t::underflow() {
+    char* data = nullptr;
+    size_t length = 0;
+    if (!_reader.next(_file, data, length)) {
+        return traits_type::eof();
+    }
+    setg(data, data, data + length);
+    return traits_type::to_int_type(*data);
+}
+
+async_reader_t::async_reader_t(const std::vector<std::string>& filenames, std::pmr::memory_resource* resource)
+    : _resource(resource) {
+    // Only the sizes to allocate the slots, the files are opened by assigning the blocks
+    uint64_t blocks_count = 0;
+    _files.reserve(filenames.size());
+    for (size_t index = 0; index < filenames.size(); ++index) {
+        file_t file;
+        file._filename = filenames[index];
+        std::error_code error;
+        const auto size = std::filesystem::file_size(file._filename, error);
+        if (!error) {
+            blocks_count += (size + _block_size - 1) / _block_size;
+        }
+        _files.push_back(std::move(file));
+        _buffers.emplace_back(*this, index);
+    }
+
+#if defined(INGRESS_DRONE_EXPLORER_IO_URING)
+    _ring = std::make_unique<ring_t>(static_cast<unsigned>(_depth));
+    if (_ring->_descriptor < 0) {
+        _ring.reset();
+    }
+#endif
+    if (!_ring) {
+        _reader = std::jthread([this](std::stop_token stop_token) { read(stop_token); });
+    }
+
+    // No more blocks than the files have
+    _slots.resize(std::clamp<uint64_t>(blocks_count, 1, _depth));
+    try {
+        for (auto& slot : _slots) {
+            slot._data = static_cast<char*>(_resource->allocate(_block_size, _alignment));
+        }
+        for (auto& slot : _slots) {
+            submit(slot);
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+async_reader_t::~async_reader_t() {
+    release();
+}
+
+void async_reader_t::release() {
+    // The kernel or the thread may still write to the blocks
+    for (auto& slot : _slots) {
+        if (slot._submitted) {
+            try {
+                wait(slot);
+            } catch (...) {
+                // Nothing else to do while releasing
+            }
+        }
+    }
+    if (_reader.joinable()) {
+        _reader.request_stop();
+        _reader.join();
+    }
+    _ring.reset();
+    for (auto& slot : _slots) {
+        if (slot._data) {
+            _resource->deallocate(slot._data, _block_size, _alignment);
+            slot._data = nullptr;
+        }
+    }
+    _slots.clear();
+    for (auto& file : _files) {
+        if (file._descriptor >= 0) {
+            close_file(file._descriptor);
+            file._descriptor = -1;
+        }
+    }
+}
+
+bool async_reader_t::open(const size_t file) {
+    auto& target = _files[file];
+    if (!target._opened) {
+        target._opened = true;
+        target._descriptor = open_file(target._filename);
+        target._failed = target._descriptor < 0;
+        if (!target._failed) {
+            target._size = size_of(target._descriptor);
+#if defined(POSIX_FADV_SEQUENTIAL)
+            posix_fadvise(target._descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+        }
+        // Opened by the consumer after the assignment passed by, e.g. it's empty
+        close_if_done(file);
+    }
+    return !target._failed;
+}
+
+void async_reader_t::close_if_done(const size_t file) {
+    auto& target = _files[file];
+    if (target._descriptor >= 0 && file < _next_file && target._pending == 0) {
+        close_file(target._descriptor);
+        target._descriptor = -1;
+    }
+}
+
+const char* async_reader_t::backend() const {
+    return _ring ? "io_uring" : "pread";
+}
+
+bool async_reader_t::next(const size_t file, char*& data, size_t& length) {
+    if (_handed) {
+        _handed = false;
+        submit(_slots[_head]);
+        _head = (_head + 1) % _slots.size();
+    }
+    while (true) {
+        auto& slot = _slots[_head];
+        if (!slot._submitted && !slot._done) {
+            // All the files are read
+            return false;
+        }
+        wait(slot);
+        if (slot._file > file) {
+            return false;
+        }
+        if (slot._file < file) {
+            // Left by the earlier file
+            --_files[slot._file]._pending;
+            close_if_done(slot._file);
+            submit(slot);
+            _head = (_head + 1) % _slots.size();
+            continue;
+        }
+        if (slot._result < 0) {
+            // Read again in place, e.g. the operation is not supported by an old kernel
+            slot._result = read_at(_files[file]._descriptor, slot._offset, slot._data, slot._length);
+        }
+        // Complete a short read so the blocks stay contiguous
+        while (slot._result >= 0 && static_cast<size_t>(slot._result) < slot._length) {
+            const auto result = read_at(
+                _files[file]._descriptor, slot._offset + slot._result, slot._data + slot._result,
+                slot._length - slot._result
+            );
+            if (result <= 0) {
+                slot._result = result < 0 ? result : -EIO;
+                break;
+            }
+            slot._result += result;
+        }
+        if (slot._result < 0) {
+            const auto error = std::strerror(static_cast<int>(-slot._result));
+            throw std::runtime_error("Unable to read file, " + std::string(error) + ".");
+        }
+        --_files[file]._pending;
+        close_if_done(file);
+        _handed = true;
+        data = slot._data;
+        length = slot._length;
+        return true;
+    }
+}
+
+void async_reader_t::submit(slot_t& slot) {
+    slot._submitted = false;
+    slot._done = false;
+    while (_next_file < _files.size() && (!open(_next_file) || _next_offset >= _files[_next_file]._size)) {
+        ++_next_file;
+        _next_offset = 0;
+        close_if_done(_next_file - 1);
+    }
+    if (_next_file >= _files.size()) {
+        return;
+    }
+    slot._file = _next_file;
+    slot._offset = _next_offset;
+    slot._length = static_cast<size_t>(std::min<uint64_t>(_block_size, _files[_next_file]._size - _next_offset));
+    _next_offset += slot._length;
+    ++_files[slot._file]._pending;
+    if (_next_offset >= _files[_next_file]._size) {
+        // Closed once the last block is handed out
+        ++_next_file;
+        _next_offset = 0;
+    }
+    slot._submitted = true;
+#if defined(INGRESS_DRONE_EXPLORER_IO_URING)
+    if (_ring) {
+        // The length is a multiple of the alignment except for the tail of a file
+        _ring->submit(
+            _files[slot._file]._descriptor, slot._data, slot._length, slot._offset,
+            static_cast<uint64_t>(&slot - _slots.data())
+        );
+        return;
+    }
+#endif
+    {
+        std::lock_guard lock(_mutex);
+        _requests.push_back(&slot);
+    }
+    _condition.notify_all();
+}
+
+void async_reader_t::wait(slot_t& slot) {
+#if defined(INGRESS_DRONE_EXPLORER_IO_URING)
+    if (_ring) {
+        while (!slot._done) {
+            _ring->reap(true, [this](const uint64_t index, const int32_t result) {
+                _slots[index]._result = result;
+                _slots[index]._done = true;
+            });
+        }
+        slot._submitted = false;
+        return;
+    }
+#endif
+    std::unique_lock lock(_mutex);
+    _condition.wait(lock, [&] { return slot._done; });
+    slot._submitted = false;
+}
+
+void async_reader_t::read(std::stop_token stop_token) {
+    std::unique_lock lock(_mutex);
+    while (_condition.wait(lock, stop_token, [this] { return !_requests.empty(); })) {
+        auto& slot = *_requests.front();
+        _requests.pop_front();
+        const auto descriptor = _files[slot._file]._descriptor;
+        const auto offset = slot._offset;
+        auto* data = slot._data;
+        const auto length = slot._length;
+        lock.unlock();
+
+        const auto result = read_at(descriptor, offset, data, length);
+
+        lock.lock();
+        slot._result = result;
+        slot._done = true;
+        _condition.notify_all();
+    }
+}
+
+} // namespace ingress_drone_explorer
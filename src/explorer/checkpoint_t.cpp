@@ -0,0 +1,197 @@
+#include "explorer/checkpoint_t.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+// Bump on any change of the layout, the values are in the native byte order
+constexpr char _magic[8] = { 'I', 'D', 'E', 'C', 'K', 'P', 'T', '2' };
+
+template<typename T>
+inline void write_value(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+inline bool read_value(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+void write_cells(std::ostream& out, const std::vector<s2::cell_t>& cells) {
+    write_value(out, static_cast<uint64_t>(cells.size()));
+    for (const auto& cell : cells) {
+        write_value(out, cell._face);
+        write_value(out, cell._level);
+        write_value(out, cell._i);
+        write_value(out, cell._j);
+    }
+}
+
+template<typename T>
+void write_values(std::ostream& out, const std::vector<T>& values) {
+    write_value(out, static_cast<uint64_t>(values.size()));
+    for (const auto value : values) {
+        write_value(out, static_cast<uint64_t>(value));
+    }
+}
+
+template<typename T>
+bool read_values(std::istream& in, std::vector<T>& values) {
+    uint64_t count = 0;
+    if (!read_value(in, count)) {
+        return false;
+    }
+    values.clear();
+    for (uint64_t index = 0; index < count; ++index) {
+        uint64_t value = 0;
+        if (!read_value(in, value)) {
+            return false;
+        }
+        values.push_back(static_cast<T>(value));
+    }
+    return true;
+}
+
+bool read_cells(std::istream& in, std::vector<s2::cell_t>& cells) {
+    uint64_t count = 0;
+    if (!read_value(in, count)) {
+        return false;
+    }
+    cells.clear();
+    for (uint64_t index = 0; index < count; ++index) {
+        uint8_t face, level;
+        int32_t i, j;
+        if (!read_value(in, face) || !read_value(in, level) || !read_value(in, i) || !read_value(in, j)) {
+            return false;
+        }
+        cells.emplace_back(face, i, j, level);
+    }
+    return true;
+}
+
+} // namespace
+
+checkpoint_t::checkpoint_t(
+    const std::string& filename,
+    const std::chrono::milliseconds interval,
+    const uint64_t digest,
+    const coordinate_t& start
+) : _filename(filename),
+    _interval(interval),
+    _digest(digest),
+    _start(start),
+    _start_time(std::chrono::steady_clock::now()),
+    _next_time(_start_time + interval),
+    _writer([this](std::stop_token stop_token) { write(stop_token); }) { }
+
+checkpoint_t::~checkpoint_t() {
+    // Write the pending state before stopping
+    _writer.request_stop();
+    _writer.join();
+}
+
+bool checkpoint_t::resume() {
+    std::ifstream in(_filename, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    char magic[sizeof(_magic)];
+    state_t state;
+    if (
+        !in.read(magic, sizeof(magic))
+        || std::memcmp(magic, _magic, sizeof(_magic)) != 0
+        || !read_value(in, state._digest)
+        || !read_value(in, state._start._lng)
+        || !read_value(in, state._start._lat)
+        || !read_value(in, state._seconds)
+        || !read_cells(in, state._queue)
+        || !read_values(in, state._queue_depths)
+        || !read_cells(in, state._reachable_cells)
+        || !read_cells(in, state._key_cells)
+        || !read_values(in, state._depth_histogram)
+        || state._queue_depths.size() != state._queue.size()
+    ) {
+        return false;
+    }
+    if (state._digest != _digest || state._start._lng != _start._lng || state._start._lat != _start._lat) {
+        return false;
+    }
+    _resumed = std::move(state);
+    return true;
+}
+
+void checkpoint_t::save(state_t&& state) {
+    const auto now = std::chrono::steady_clock::now();
+    state._digest = _digest;
+    state._start = _start;
+    state._seconds = 1E-6 * std::chrono::duration_cast<std::chrono::microseconds>(now - _start_time).count();
+    if (_resumed) {
+        state._seconds += _resumed->_seconds;
+    }
+    {
+        std::lock_guard lock(_mutex);
+        _pending = std::move(state);
+    }
+    _condition.notify_all();
+    _next_time = now + _interval;
+}
+
+void checkpoint_t::remove() {
+    std::unique_lock lock(_mutex);
+    _condition.wait(lock, [this] { return !_pending && !_writing; });
+    std::error_code error;
+    std::filesystem::remove(_filename, error);
+}
+
+std::string checkpoint_t::error() const {
+    std::lock_guard lock(_mutex);
+    return _error;
+}
+
+void checkpoint_t::write(std::stop_token stop_token) {
+    std::unique_lock lock(_mutex);
+    while (_condition.wait(lock, stop_token, [this] { return _pending.has_value(); })) {
+        const auto state = std::move(*_pending);
+        _pending.reset();
+        _writing = true;
+        lock.unlock();
+
+        // Replace the file at once so a preemption never leaves a partial checkpoint
+        const auto temporary_filename = _filename + ".tmp";
+        std::string error;
+        {
+            std::ofstream out(temporary_filename, std::ios::binary | std::ios::trunc);
+            out.write(_magic, sizeof(_magic));
+            write_value(out, state._digest);
+            write_value(out, state._start._lng);
+            write_value(out, state._start._lat);
+            write_value(out, state._seconds);
+            write_cells(out, state._queue);
+            write_values(out, state._queue_depths);
+            write_cells(out, state._reachable_cells);
+            write_cells(out, state._key_cells);
+            write_values(out, state._depth_histogram);
+            if (!out) {
+                error = "Unable to write checkpoint file.";
+            }
+        }
+        if (error.empty()) {
+            std::error_code rename_error;
+            std::filesystem::rename(temporary_filename, _filename, rename_error);
+            if (rename_error) {
+                error = "Unable to write checkpoint file.";
+            }
+        }
+
+        lock.lock();
+        _writing = false;
+        _error = error;
+        _condition.notify_all();
+    }
+}
+
+} // namespace ingress_drone_explorer
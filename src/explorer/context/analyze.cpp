@@ -0,0 +1,341 @@
+#include "explorer/context_t.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+constexpr auto none = std::numeric_limits<size_t>::max();
+
+} // namespace
+
+std::vector<radius_reachability_t> context_t::analyze_radii_from(
+    const coordinate_t& start, const std::vector<double>& radii
+) const {
+    if (radii.empty()) {
+        return { };
+    }
+    const auto& cells = _index.cells();
+    const auto start_cell = s2::cell_t(start);
+    const auto max_radius = *std::max_element(radii.begin(), radii.end());
+
+    // Bottleneck (minimax) Dijkstra: the critical radius of a cell is the minimum over all paths from the start of the
+    // maximum hop distance on the path, so a cell is reachable within radius r if and only if its critical radius < r.
+    using item_t = std::pair<double, s2::cell_t>;
+    std::priority_queue<item_t, std::vector<item_t>, std::greater<item_t>> queue;
+    std::map<s2::cell_t, double> pending;
+    const auto push = [&](const s2::cell_t& cell, const double radius) {
+        const auto it = pending.find(cell);
+        if (pending.end() != it && it->second <= radius) {
+            return;
+        }
+        pending.insert_or_assign(cell, radius);
+        queue.emplace(radius, cell);
+    };
+
+    if (cells.contains(start_cell)) {
+        push(start_cell, 0);
+    } else {
+        for (const auto& cell : start_cell.neighbored_cells_covering_cap_of(start, max_radius)) {
+            if (cells.contains(cell)) {
+                push(cell, cell.distance_to(start));
+            }
+        }
+    }
+
+    cell_portals_map_t cells_containing_keys(_index.cells_containing_keys(), &_index.memory()._exploration);
+    std::map<s2::cell_t, double> critical_radii;
+
+    const int32_t safe_rounds_for_max_radius = static_cast<int32_t>(max_radius / 80) + 1;
+    while (!queue.empty()) {
+        const auto [radius, cell] = queue.top();
+        queue.pop();
+        if (critical_radii.contains(cell)) {
+            continue;
+        }
+        critical_radii.emplace(cell, radius);
+        cells_containing_keys.erase(cell);
+
+        const auto& portals = cells.at(cell);
+        for (const auto& neighbor : cell.neighbored_cells_in(safe_rounds_for_max_radius)) {
+            if (critical_radii.contains(neighbor) || !cells.contains(neighbor)) {
+                continue;
+            }
+            // Could not be improved since the radius never decreases along a path
+            if (const auto it = pending.find(neighbor); pending.end() != it && it->second <= radius) {
+                continue;
+            }
+            auto distance = max_radius;
+            for (const auto& portal : portals) {
+                distance = std::min(distance, neighbor.distance_to(portal._coordinate));
+            }
+            if (distance < max_radius) {
+                push(neighbor, std::max(radius, distance));
+            }
+        }
+
+        // Keys do not depend on the visible radius, the cells containing them share the radius of the trigger
+        std::erase_if(cells_containing_keys, [&](const auto& item) {
+            for (const auto& portal : portals) {
+                for (const auto& target : item.second) {
+                    if (portal._coordinate.distance_to(target._coordinate) < _reachable_radius_with_key) {
+                        push(item.first, radius);
+                        return true;
+                    }
+                }
+            }
+            return false;
+        });
+    }
+
+    auto sorted_radii = radii;
+    std::sort(sorted_radii.begin(), sorted_radii.end());
+    std::vector<radius_reachability_t> result;
+    for (const auto limit : sorted_radii) {
+        radius_reachability_t reachability { limit };
+        for (const auto& [cell, radius] : critical_radii) {
+            if (radius < limit) {
+                ++reachability._reachable_cells_count;
+                reachability._reachable_portals_count += cells.at(cell).size();
+            }
+        }
+        result.push_back(reachability);
+    }
+    return result;
+}
+
+key_analysis_t context_t::analyze_keys_from(const coordinate_t& start) const {
+    const auto& cells = _index.cells();
+    struct key_t {
+        s2::cell_t      _cell;
+        const portal_t* _portal;
+    };
+    std::vector<key_t> keys;
+    for (const auto& [cell, portals] : _index.cells_containing_keys()) {
+        const auto& cell_portals = cells.at(cell);
+        for (const auto& portal : portals) {
+            keys.push_back({ cell, &*cell_portals.find(portal) });
+        }
+    }
+
+    // Explore with all the Keys once and keep the graph, every further question is answered within it
+    struct node_t {
+        s2::cell_t                                  _cell;
+        size_t                                      _portals_count = 0;
+        std::vector<size_t>                         _visible;
+        std::vector<std::pair<size_t, size_t>>      _keys;  // (Key, node)
+        std::vector<size_t>                         _incoming_visible;
+        std::vector<size_t>                         _children;
+        size_t                                      _parent_key = none;
+    };
+    std::vector<node_t> nodes;
+    std::map<s2::cell_t, size_t> indices;
+    std::vector<size_t> queue;
+    const auto discover = [&](const s2::cell_t& cell, const size_t parent, const size_t parent_key) -> size_t {
+        const auto [it, inserted] = indices.emplace(cell, nodes.size());
+        if (inserted) {
+            nodes.push_back({ cell, cells.at(cell).size(), { }, { }, { }, { }, parent_key });
+            if (none != parent) {
+                nodes[parent]._children.push_back(it->second);
+            }
+            queue.push_back(it->second);
+        }
+        return it->second;
+    };
+
+    std::vector<size_t> start_nodes;
+    for (const auto& cell : start_cells_of(start)) {
+        start_nodes.push_back(discover(cell, none, none));
+    }
+
+    std::vector<std::vector<size_t>> triggers(keys.size());
+    constexpr int32_t safe_rounds_for_visible_radius = (_visible_radius / 80) + 1;
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const auto index = queue[head];
+        const auto cell = nodes[index]._cell;
+        const auto& portals = cells.at(cell);
+        for (const auto& neighbor : cell.neighbored_cells_in(safe_rounds_for_visible_radius)) {
+            if (!cells.contains(neighbor)) {
+                continue;
+            }
+            for (const auto& portal : portals) {
+                if (neighbor.intersects_with_cap_of(portal._coordinate, _visible_radius)) {
+                    const auto target = discover(neighbor, index, none);
+                    nodes[index]._visible.push_back(target);
+                    nodes[target]._incoming_visible.push_back(index);
+                    break;
+                }
+            }
+        }
+        for (size_t key = 0; key < keys.size(); ++key) {
+            for (const auto& portal : portals) {
+                if (portal._coordinate.distance_to(keys[key]._portal->_coordinate) < _reachable_radius_with_key) {
+                    const auto target = discover(keys[key]._cell, index, key);
+                    nodes[index]._keys.emplace_back(key, target);
+                    triggers[key].push_back(index);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Without any Key
+    std::vector<bool> in_base(nodes.size(), false);
+    for (const auto index : start_nodes) {
+        in_base[index] = true;
+    }
+    std::vector<size_t> stack = start_nodes;
+    size_t base_cells_count = 0;
+    size_t base_portals_count = 0;
+    while (!stack.empty()) {
+        const auto index = stack.back();
+        stack.pop_back();
+        ++base_cells_count;
+        base_portals_count += nodes[index]._portals_count;
+        for (const auto target : nodes[index]._visible) {
+            if (!in_base[target]) {
+                in_base[target] = true;
+                stack.push_back(target);
+            }
+        }
+    }
+
+    std::vector<std::vector<size_t>> keys_of_node(nodes.size());
+    for (size_t key = 0; key < keys.size(); ++key) {
+        if (const auto it = indices.find(keys[key]._cell); indices.end() != it) {
+            keys_of_node[it->second].push_back(key);
+        }
+    }
+
+    struct impact_t {
+        size_t  _key;
+        size_t  _alone_cells_count = 0;
+        size_t  _alone_portals_count = 0;
+        size_t  _marginal_cells_count = 0;
+        size_t  _marginal_portals_count = 0;
+    };
+    std::vector<impact_t> impacts;
+    // Stamp with (key + 1) to avoid clearing the marks for every Key
+    std::vector<size_t> visited(nodes.size(), 0);
+    std::vector<size_t> in_subtree(nodes.size(), 0);
+    std::vector<size_t> recovered(nodes.size(), 0);
+    for (size_t key = 0; key < keys.size(); ++key) {
+        impact_t impact { key };
+        const auto stamp = key + 1;
+        const auto it = indices.find(keys[key]._cell);
+        if (indices.end() == it) {
+            impacts.push_back(impact);
+            continue;
+        }
+        const auto node = it->second;
+
+        // Alone: flood from the cell containing the Key if it's triggered by the base region
+        const auto triggered_by_base = std::any_of(
+            triggers[key].begin(), triggers[key].end(), [&](const auto index) { return in_base[index]; }
+        );
+        if (!in_base[node] && triggered_by_base) {
+            visited[node] = stamp;
+            stack = { node };
+            while (!stack.empty()) {
+                const auto index = stack.back();
+                stack.pop_back();
+                ++impact._alone_cells_count;
+                impact._alone_portals_count += nodes[index]._portals_count;
+                for (const auto target : nodes[index]._visible) {
+                    if (!in_base[target] && visited[target] != stamp) {
+                        visited[target] = stamp;
+                        stack.push_back(target);
+                    }
+                }
+            }
+        }
+
+        // Given the others: only the subtree discovered through this Key may be lost, recover what is still reachable
+        // from outside of it without the Key.
+        if (nodes[node]._parent_key == key) {
+            std::vector<size_t> subtree { node };
+            in_subtree[node] = stamp;
+            for (size_t head = 0; head < subtree.size(); ++head) {
+                for (const auto child : nodes[subtree[head]]._children) {
+                    in_subtree[child] = stamp;
+                    subtree.push_back(child);
+                }
+            }
+            const auto outside = [&](const size_t index) { return in_subtree[index] != stamp; };
+            stack.clear();
+            for (const auto index : subtree) {
+                bool reachable = std::any_of(
+                    nodes[index]._incoming_visible.begin(), nodes[index]._incoming_visible.end(), outside
+                );
+                for (const auto other : keys_of_node[index]) {
+                    if (reachable) {
+                        break;
+                    }
+                    reachable = other != key && std::any_of(triggers[other].begin(), triggers[other].end(), outside);
+                }
+                if (reachable) {
+                    recovered[index] = stamp;
+                    stack.push_back(index);
+                }
+            }
+            size_t recovered_cells_count = 0;
+            size_t recovered_portals_count = 0;
+            while (!stack.empty()) {
+                const auto index = stack.back();
+                stack.pop_back();
+                ++recovered_cells_count;
+                recovered_portals_count += nodes[index]._portals_count;
+                const auto recover = [&](const size_t target) {
+                    if (!outside(target) && recovered[target] != stamp) {
+                        recovered[target] = stamp;
+                        stack.push_back(target);
+                    }
+                };
+                for (const auto target : nodes[index]._visible) {
+                    recover(target);
+                }
+                for (const auto& [other, target] : nodes[index]._keys) {
+                    if (other != key) {
+                        recover(target);
+                    }
+                }
+            }
+            impact._marginal_cells_count = subtree.size() - recovered_cells_count;
+            for (const auto index : subtree) {
+                impact._marginal_portals_count += nodes[index]._portals_count;
+            }
+            impact._marginal_portals_count -= recovered_portals_count;
+        }
+        impacts.push_back(impact);
+    }
+
+    std::sort(impacts.begin(), impacts.end(), [](const auto& a, const auto& b) {
+        if (a._marginal_cells_count != b._marginal_cells_count) {
+            return a._marginal_cells_count > b._marginal_cells_count;
+        }
+        return a._alone_cells_count > b._alone_cells_count;
+    });
+
+    key_analysis_t result;
+    result._base_reachable_cells_count = base_cells_count;
+    result._base_reachable_portals_count = base_portals_count;
+    result._reachable_cells_count = nodes.size();
+    for (const auto& node : nodes) {
+        result._reachable_portals_count += node._portals_count;
+    }
+    for (const auto& impact : impacts) {
+        result._impacts.push_back({
+            *keys[impact._key]._portal,
+            impact._alone_cells_count,
+            impact._alone_portals_count,
+            impact._marginal_cells_count,
+            impact._marginal_portals_count,
+        });
+    }
+    return result;
+}
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,238 @@
+#include "explorer/context_t.hpp"
+
+#include <algorithm>
+
+namespace ingress_drone_explorer {
+
+void context_t::explore_from(
+    const coordinate_t& start, const progress_callback_t& on_progress, checkpoint_t* checkpoint
+) {
+    reset(start);
+    if (_index.summarized()) {
+        explore_hierarchically(on_progress);
+        return;
+    }
+    const auto& cells = _index.cells();
+    cell_depth_map_t queue(&_index.memory()._exploration);
+    for (const auto& cell : start_cells_of(start)) {
+        queue.emplace(cell, 0);
+    }
+    cell_portals_map_t cells_containing_keys(_index.cells_containing_keys(), &_index.memory()._exploration);
+    std::erase_if(cells_containing_keys, [&](const auto& item) { return queue.contains(item.first); });
+    if (checkpoint && checkpoint->resumed()) {
+        const auto& state = *checkpoint->resumed();
+        queue.clear();
+        for (size_t index = 0; index < state._queue.size(); ++index) {
+            queue.emplace(state._queue[index], state._queue_depths[index]);
+        }
+        for (const auto& cell : state._reachable_cells) {
+            const auto portals = cells.find(cell);
+            if (cells.end() != portals) {
+                _reachable_cells.insert(cell);
+                reach(portals->second);
+            }
+        }
+        _depth_histogram = state._depth_histogram;
+        cell_portals_map_t resumed_cells_containing_keys(&_index.memory()._exploration);
+        for (const auto& cell : state._key_cells) {
+            const auto it = _index.cells_containing_keys().find(cell);
+            if (_index.cells_containing_keys().end() != it) {
+                resumed_cells_containing_keys.insert(*it);
+            }
+        }
+        cells_containing_keys.swap(resumed_cells_containing_keys);
+    }
+
+    size_t iterations = 0;
+
+    for (auto it = queue.begin(); it != queue.end(); it = queue.begin()) {
+        const auto portals = cells.find(it->first);
+        if (cells.end() == portals) {
+            queue.erase(it);
+            continue;
+        }
+        // A Key cell may be queued again after being reached by visibility
+        if (!_reachable_cells.insert(it->first).second) {
+            queue.erase(it);
+            continue;
+        }
+        reach(portals->second);
+        const auto depth = it->second;
+        if (_depth_histogram.size() <= depth) {
+            _depth_histogram.resize(depth + 1);
+        }
+        ++_depth_histogram[depth];
+
+        // Get all neighbors in the visible range (also the possible ones), filter the empty/pending/reached ones and
+        // search for reachable ones
+        constexpr int32_t safe_rounds_for_visible_radius = (_visible_radius / 80) + 1;
+        const auto neighbors = it->first.neighbored_cells_in(safe_rounds_for_visible_radius);
+        for (const auto& neighbor : neighbors) {
+            if (queue.contains(neighbor) || _reachable_cells.contains(neighbor) || !cells.contains(neighbor)) {
+                continue;
+            }
+            for (const auto& portal : portals->second) {
+                if (neighbor.intersects_with_cap_of(portal._coordinate, _visible_radius)) {
+                    queue.emplace(neighbor, depth + 1);
+                    break;
+                }
+            }
+        }
+
+        queue.erase(it);
+
+        // Find keys
+        /// TODO: Consider to use cell.neighbored_cells_in instead?
+        if (!cells_containing_keys.empty()) {
+            for (const auto& portal : portals->second) {
+                std::erase_if(cells_containing_keys, [&](const auto& item) {
+                    bool shouldErase = false;
+                    if (queue.contains(item.first) || _reachable_cells.contains(item.first)) {
+                        shouldErase = true;
+                    } else {
+                        for (const auto& target : item.second) {
+                            if (portal._coordinate.distance_to(target._coordinate) < _reachable_radius_with_key) {
+                                queue.emplace(item.first, depth + 1);
+                                shouldErase = true;
+                                break;
+                            }
+                        }
+                    }
+                    return shouldErase;
+                });
+                if (cells_containing_keys.empty()) {
+                    break;
+                }
+            }
+        }
+
+        if ((++iterations & _progress_mask) == 0) {
+            if (on_progress) {
+                on_progress(_reachable_cells.size(), cells.size());
+            }
+            if (checkpoint && checkpoint->due()) {
+                checkpoint_t::state_t state;
+                state._queue.reserve(queue.size());
+                state._queue_depths.reserve(queue.size());
+                for (const auto& [cell, depth] : queue) {
+                    state._queue.push_back(cell);
+                    state._queue_depths.push_back(depth);
+                }
+                state._reachable_cells.assign(_reachable_cells.begin(), _reachable_cells.end());
+                state._key_cells.reserve(cells_containing_keys.size());
+                for (const auto& entry : cells_containing_keys) {
+                    state._key_cells.push_back(entry.first);
+                }
+                state._depth_histogram = _depth_histogram;
+                checkpoint->save(std::move(state));
+            }
+        }
+    }
+}
+
+void context_t::explore_hierarchically(const progress_callback_t& on_progress) {
+    const auto& cells = _index.cells();
+    const auto& summaries = _index.summaries();
+    const auto& edges = _index.edges();
+    const auto start_cells = start_cells_of(_start);
+    std::pmr::vector<s2::cell_t> stack(start_cells.begin(), start_cells.end(), &_index.memory()._exploration);
+
+    size_t iterations = 0;
+
+    // Reach all the children at once in connected parents and leave by the exits, descend to cells in others
+    while (!stack.empty()) {
+        const auto cell = stack.back();
+        stack.pop_back();
+        if (_reachable_cells.contains(cell)) {
+            continue;
+        }
+        const auto& summary = summaries.at(index_t::parent_of(cell));
+        const std::pmr::vector<s2::cell_t>* targets = nullptr;
+        if (summary._connected) {
+            for (const auto& child : summary._cells) {
+                if (_reachable_cells.insert(child).second) {
+                    reach(cells.at(child));
+                }
+            }
+            targets = &summary._exits;
+        } else {
+            _reachable_cells.insert(cell);
+            reach(cells.at(cell));
+            const auto it = edges.find(cell);
+            if (edges.end() == it) {
+                continue;
+            }
+            targets = &it->second;
+        }
+        for (const auto& target : *targets) {
+            if (!_reachable_cells.contains(target)) {
+                stack.push_back(target);
+            }
+        }
+
+        if ((++iterations & _progress_mask) == 0) {
+            if (on_progress) {
+                on_progress(_reachable_cells.size(), cells.size());
+            }
+        }
+    }
+}
+
+void context_t::restore(const coordinate_t& start, const std::vector<s2::cell_t>& reachable_cells) {
+    reset(start);
+    const auto& cells = _index.cells();
+    for (const auto& cell : reachable_cells) {
+        const auto portals = cells.find(cell);
+        if (cells.end() != portals) {
+            _reachable_cells.insert(cell);
+            reach(portals->second);
+        }
+    }
+}
+
+void context_t::reset(const coordinate_t& start) {
+    _start = start;
+    _reachable_cells.clear();
+    _reachable_portals_count = 0;
+    _furthest_portals.clear();
+    _distance_histogram.clear();
+    _depth_histogram.clear();
+}
+
+void context_t::reach(const portal_set_t& portals) {
+    _reachable_portals_count += portals.size();
+    for (const auto& portal : portals) {
+        const auto distance = _start.distance_to(portal._coordinate);
+        const auto bin = static_cast<size_t>(distance / report_t::_distance_bin_width);
+        if (_distance_histogram.size() <= bin) {
+            _distance_histogram.resize(bin + 1);
+        }
+        ++_distance_histogram[bin];
+        if (_furthest_portals.size() < report_t::_furthest_portals_limit) {
+            _furthest_portals.emplace_back(distance, &portal);
+            std::push_heap(_furthest_portals.begin(), _furthest_portals.end(), std::greater<>());
+        } else if (_furthest_portals.front().first < distance) {
+            std::pop_heap(_furthest_portals.begin(), _furthest_portals.end(), std::greater<>());
+            _furthest_portals.back() = { distance, &portal };
+            std::push_heap(_furthest_portals.begin(), _furthest_portals.end(), std::greater<>());
+        }
+    }
+}
+
+context_t::cell_set_t context_t::start_cells_of(const coordinate_t& start) const {
+    const auto& cells = _index.cells();
+    const auto start_cell = s2::cell_t(start);
+    cell_set_t result(&_index.memory()._exploration);
+    if (cells.contains(start_cell)) {
+        result.insert(start_cell);
+        return result;
+    }
+    for (const auto& cell : start_cell.neighbored_cells_covering_cap_of(start, _visible_radius)) {
+        if (cells.contains(cell)) {
+            result.insert(cell);
+        }
+    }
+    return result;
+}
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,30 @@
+#include "explorer/context_t.hpp"
+
+#include <algorithm>
+
+namespace ingress_drone_explorer {
+
+report_t context_t::report() const {
+    report_t result;
+    result._cells_count = _index.cells().size();
+    result._reachable_cells_count = _reachable_cells.size();
+    result._portals_count = _index.portals_count();
+    result._reachable_portals_count = _reachable_portals_count;
+    auto furthest_portals = _furthest_portals;
+    std::sort_heap(furthest_portals.begin(), furthest_portals.end(), std::greater<>());
+    result._furthest_portals.reserve(furthest_portals.size());
+    for (const auto& [distance, portal] : furthest_portals) {
+        result._furthest_portals.push_back({ *portal, distance });
+    }
+    if (result._furthest_portals.empty()) {
+        result._furthest_portal._coordinate = _start;
+    } else {
+        result._furthest_portal = result._furthest_portals.front()._portal;
+        result._furthest_distance = result._furthest_portals.front()._distance;
+    }
+    result._distance_histogram = _distance_histogram;
+    result._depth_histogram = _depth_histogram;
+    return result;
+}
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,103 @@
+#include "explorer/context_t.hpp"
+
+#include <algorithm>
+#include <queue>
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+struct step_t {
+    s2::cell_t      _from;
+    const portal_t* _portal = nullptr;
+    const portal_t* _key = nullptr;
+};
+
+} // namespace
+
+search_result_t context_t::search_from(
+    const coordinate_t& start, const s2::cell_t& target_cell, const coordinate_t& target
+) const {
+    const auto& cells = _index.cells();
+
+    // Greedy best-first search, always expand the pending cell closest to the target and stop once the target cell is
+    // discovered.
+    using item_t = std::pair<double, s2::cell_t>;
+    std::priority_queue<item_t, std::vector<item_t>, std::greater<item_t>> queue;
+    std::map<s2::cell_t, step_t> steps;
+    const auto push = [&](const s2::cell_t& cell, const step_t& step) {
+        steps.emplace(cell, step);
+        queue.emplace(cell.distance_to(target), cell);
+        return cell == target_cell;
+    };
+
+    bool found = false;
+    for (const auto& cell : start_cells_of(start)) {
+        found = push(cell, { cell }) || found;
+    }
+
+    cell_portals_map_t cells_containing_keys(_index.cells_containing_keys(), &_index.memory()._exploration);
+    std::erase_if(cells_containing_keys, [&](const auto& item) { return steps.contains(item.first); });
+
+    constexpr int32_t safe_rounds_for_visible_radius = (_visible_radius / 80) + 1;
+    while (!found && !queue.empty()) {
+        const auto cell = queue.top().second;
+        queue.pop();
+        const auto& portals = cells.at(cell);
+
+        for (const auto& neighbor : cell.neighbored_cells_in(safe_rounds_for_visible_radius)) {
+            if (steps.contains(neighbor) || !cells.contains(neighbor)) {
+                continue;
+            }
+            for (const auto& portal : portals) {
+                if (neighbor.intersects_with_cap_of(portal._coordinate, _visible_radius)) {
+                    found = push(neighbor, { cell, &portal });
+                    break;
+                }
+            }
+            if (found) {
+                break;
+            }
+        }
+
+        if (found || cells_containing_keys.empty()) {
+            continue;
+        }
+        std::erase_if(cells_containing_keys, [&](const auto& item) {
+            if (found) {
+                return false;
+            }
+            if (steps.contains(item.first)) {
+                // Discovered by visibility already
+                return true;
+            }
+            for (const auto& portal : portals) {
+                for (const auto& key : item.second) {
+                    if (portal._coordinate.distance_to(key._coordinate) < _reachable_radius_with_key) {
+                        found = push(item.first, { cell, &portal, &*cells.at(item.first).find(key) });
+                        return true;
+                    }
+                }
+            }
+            return false;
+        });
+    }
+
+    search_result_t result;
+    result._found = found;
+    result._discovered_cells_count = steps.size();
+    if (!found) {
+        return result;
+    }
+    for (auto cell = target_cell; steps.at(cell)._portal; cell = steps.at(cell)._from) {
+        const auto& step = steps.at(cell);
+        auto& hop = result._hops.emplace_back(step._from, *step._portal, std::nullopt);
+        if (step._key) {
+            hop._key = *step._key;
+        }
+    }
+    std::reverse(result._hops.begin(), result._hops.end());
+    return result;
+}
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,370 @@
+#include "explorer/index_t.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <semaphore>
+#include <thread>
+
+#include <boost/json.hpp>
+
+#include "explorer/async_reader_t.hpp"
+#include "explorer/numa_t.hpp"
+#include "extensions/json_resource.hpp"
+#include "extensions/tag_invoke.hpp"
+#include "s2/batch.hpp"
+#include "utils/fnv1a.hpp"
+#include "utils/match_pattern.hpp"
+#include "utils/ring_buffer.hpp"
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+// Heap of the strings in a Portal, which are not allocated from the resources
+inline size_t heap_bytes_of(const portal_t& portal) {
+    static const auto small_capacity = std::string().capacity();
+    size_t bytes = 0;
+    for (const auto* value : { &portal._guid, &portal._title }) {
+        if (value->capacity() > small_capacity) {
+            bytes += value->capacity() + 1;
+        }
+    }
+    return bytes;
+}
+
+boost::json::value parse_list_from(std::istream& in, json_resource_t& resource) {
+    boost::json::stream_parser parser;
+    parser.reset(&resource);
+    std::string line;
+    while (!in.eof() && !parser.done()) {
+        std::getline(in, line);
+        parser.write(line);
+    }
+    return parser.release();
+}
+
+void update(fnv1a_t& hasher, const index_t::cell_portals_map_t& cells) {
+    hasher.update(cells.size());
+    for (const auto& [cell, portals] : cells) {
+        hasher.update(cell._face);
+        hasher.update(cell._level);
+        hasher.update(cell._i);
+        hasher.update(cell._j);
+        hasher.update(portals.size());
+        for (const auto& portal : portals) {
+            hasher.update(portal._guid);
+            hasher.update(portal._coordinate._lng);
+            hasher.update(portal._coordinate._lat);
+        }
+    }
+}
+
+} // namespace
+
+index_t::index_t(const size_t memory_limit)
+    : _memory(std::make_unique<memory_t>(memory_limit)),
+    _cells(&_memory->_portals),
+    _guids(&_memory->_guids),
+    _cells_containing_keys(&_memory->_keys),
+    _summaries(&_memory->_summaries),
+    _edges(&_memory->_summaries) { }
+
+size_t index_t::load_portals(const std::vector<std::string>& filenames, const file_callback_t& on_file_loaded) {
+    std::set<std::string> urls;
+    for (const auto& filename : filenames) {
+        if (std::string::npos == filename.find('*')) {
+            urls.insert(filename);
+            continue;
+        }
+        // Resolve wildcard
+        const std::filesystem::path url(filename);
+        const auto parent = url.parent_path();
+        if (std::string::npos != parent.string().find('*')) {
+            throw std::runtime_error("Invalid wildcard.");
+        }
+        const auto pattern = url.filename().string();
+        std::filesystem::directory_iterator iterator(parent);
+        for (const auto& entry : iterator) {
+            const auto realPath = entry.path();
+            if (match_pattern(realPath.filename().string(), pattern)) {
+                urls.insert(realPath.string());
+            }
+        }
+    }
+
+    _summaries.clear();
+    _edges.clear();
+    // Read all the regular files ahead while parsing, the others like pipes as streams
+    std::vector<std::string> regular_urls;
+    for (const auto& url : urls) {
+        std::error_code error;
+        if (url != "-" && std::filesystem::is_regular_file(url, error)) {
+            regular_urls.push_back(url);
+        }
+    }
+    async_reader_t reader(regular_urls, &_memory->_reading);
+    size_t regular_index = 0;
+    for (const auto& url : urls) {
+        file_statistics_t statistics { url };
+        if (url == "-") {
+            load_portals_from(std::cin, statistics);
+        } else if (regular_index < regular_urls.size() && regular_urls[regular_index] == url) {
+            const auto index = regular_index++;
+            if (!reader.open(index)) {
+                throw std::runtime_error("Unable to open portal list file.");
+            }
+            std::istream in(&reader.buffer_of(index));
+            // Raise the errors of reading instead of ending the file
+            in.exceptions(std::ios::badbit);
+            load_portals_from(in, statistics);
+        } else {
+            std::ifstream in(url);
+            if (!in.is_open()) {
+                throw std::runtime_error("Unable to open portal list file.");
+            }
+            load_portals_from(in, statistics);
+        }
+        _portals_count += statistics._portals_count;
+        if (on_file_loaded) {
+            on_file_loaded(statistics);
+        }
+    }
+    return urls.size();
+}
+
+void index_t::load_portals_from(std::istream& in, file_statistics_t& statistics) {
+    in >> std::ws;
+    if (in.peek() != '[') {
+        load_portals_as_lines_from(in, statistics);
+        return;
+    }
+    json_resource_t resource(_memory->_json);
+    auto portals = boost::json::value_to<std::vector<portal_t>>(parse_list_from(in, resource));
+    insert(portals, statistics);
+}
+
+void index_t::load_portals_as_lines_from(std::istream& in, file_statistics_t& statistics) {
+    using batch_t = std::vector<portal_t>;
+    constexpr size_t batch_size = 4096;
+
+    // Parse in another thread and insert here, the buffer keeps the memory flat. Both sides block on semaphores, the
+    // parser waits for free slots and the inserter for filled ones, which also count the final signal of the parser.
+    constexpr ptrdiff_t capacity = 8;
+    ring_buffer_t<batch_t, capacity> buffer;
+    std::counting_semaphore<capacity> free_slots(capacity);
+    std::counting_semaphore<capacity + 1> filled_slots(0);
+    std::exception_ptr exception;
+    json_resource_t resource(_memory->_json);
+    std::jthread parser_thread([&](std::stop_token stop_token) {
+        const auto push = [&](batch_t&& batch) {
+            while (!free_slots.try_acquire_for(std::chrono::milliseconds(100))) {
+                if (stop_token.stop_requested()) {
+                    return false;
+                }
+            }
+            buffer.try_push(std::move(batch));
+            filled_slots.release();
+            return true;
+        };
+        try {
+            batch_t batch;
+            batch.reserve(batch_size);
+            std::string line;
+            size_t line_number = 0;
+            while (std::getline(in, line)) {
+                ++line_number;
+                if (line.find_first_not_of(" \t\r") == std::string::npos) {
+                    continue;
+                }
+                boost::json::error_code error;
+                const auto value = boost::json::parse(line, error, &resource);
+                if (error) {
+                    throw std::runtime_error("Invalid Portal at line " + std::to_string(line_number) + ".");
+                }
+                batch.push_back(boost::json::value_to<portal_t>(value));
+                if (batch.size() == batch_size) {
+                    if (!push(std::move(batch))) {
+                        return;
+                    }
+                    batch = { };
+                    batch.reserve(batch_size);
+                }
+            }
+            if (!batch.empty()) {
+                push(std::move(batch));
+            }
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        filled_slots.release();
+    });
+
+    batch_t batch;
+    while (true) {
+        filled_slots.acquire();
+        if (!buffer.try_pop(batch)) {
+            // The final signal, every batch pushed before it has been popped
+            break;
+        }
+        free_slots.release();
+        insert(batch, statistics);
+    }
+    parser_thread.join();
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void index_t::insert(const std::vector<portal_t>& portals, file_statistics_t& statistics) {
+    // Project the whole batch at once
+    std::vector<double> lngs, lats;
+    lngs.reserve(portals.size());
+    lats.reserve(portals.size());
+    for (const auto& portal : portals) {
+        lngs.push_back(portal._coordinate._lng);
+        lats.push_back(portal._coordinate._lat);
+    }
+    std::vector<s2::cell_t> cells;
+    s2::cells_of(lngs.data(), lats.data(), portals.size(), 16, cells);
+    for (size_t index = 0; index < portals.size(); ++index) {
+        const auto& portal = portals[index];
+        const auto& cell = cells[index];
+        const auto it_guid = _guids.find(portal._guid);
+        if (_guids.end() != it_guid) {
+            // Duplicated in any file, the titled one wins
+            if (portal._title.empty()) {
+                continue;
+            }
+            const auto [previous_cell, previous_portal] = it_guid->second;
+            _guids.erase(it_guid);
+            const auto it_previous_cell = _cells.find(previous_cell);
+            auto& previous_portals = it_previous_cell->second;
+            _memory->_portals.discharge(heap_bytes_of(*previous_portal));
+            previous_portals.erase(previous_portals.find(*previous_portal));
+            // Moved to another cell
+            if (previous_portals.empty() && previous_cell != cell) {
+                _cells.erase(it_previous_cell);
+            }
+        } else {
+            ++statistics._portals_count;
+        }
+        if (_placed) {
+            _memory->_placement.select(node_of(cell));
+        }
+        auto [it_cell, inserted_cell] = _cells.try_emplace(cell);
+        if (inserted_cell) {
+            ++statistics._cells_count;
+        }
+        const auto& stored = *it_cell->second.insert(portal).first;
+        _memory->_portals.charge(heap_bytes_of(stored));
+        _guids.emplace(stored._guid, location_t { cell, &stored });
+    }
+}
+
+index_t::keys_statistics_t index_t::load_keys(const std::string& filename) {
+    json_resource_t resource(_memory->_json);
+    // Constructed from the parsed one to keep its storage
+    const auto value = [&] {
+        std::error_code error;
+        if (!std::filesystem::is_regular_file(filename, error)) {
+            std::ifstream in(filename);
+            if (!in.is_open()) {
+                throw std::runtime_error("Unable to open key list file.");
+            }
+            return parse_list_from(in, resource);
+        }
+        async_reader_t reader({ filename }, &_memory->_reading);
+        if (!reader.open(0)) {
+            throw std::runtime_error("Unable to open key list file.");
+        }
+        std::istream in(&reader.buffer_of(0));
+        in.exceptions(std::ios::badbit);
+        return parse_list_from(in, resource);
+    }();
+    auto list = boost::json::value_to<std::vector<std::string>>(value);
+    _summaries.clear();
+    _edges.clear();
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+    size_t matched_count = 0;
+    for (const auto& guid : list) {
+        const auto it_guid = _guids.find(guid);
+        if (_guids.end() == it_guid) {
+            continue;
+        }
+        ++matched_count;
+        const auto& [cell, portal] = it_guid->second;
+        const auto [it_key, inserted] = _cells_containing_keys[cell].insert(*portal);
+        if (inserted) {
+            _memory->_keys.charge(heap_bytes_of(*it_key));
+        }
+    }
+    return { list.size(), matched_count };
+}
+
+std::vector<index_t::node_statistics_t> index_t::place_on_nodes() {
+    const auto nodes_count = numa_t::topology().nodes().size();
+    auto& placement = _memory->_placement;
+    placement.place();
+
+    // The sorted cells are strips of the faces
+    std::vector<node_statistics_t> result(nodes_count);
+    std::vector<s2::cell_t> node_bounds;
+    cell_portals_map_t cells(&_memory->_portals);
+    size_t rank = 0;
+    size_t heap_bytes = 0;
+    for (const auto& [cell, portals] : _cells) {
+        const auto node = rank * nodes_count / _cells.size();
+        while (node_bounds.size() < node) {
+            node_bounds.push_back(cell);
+        }
+        placement.select(node);
+        // Copied instead of moved, so the nodes are allocated again
+        const auto& placed_portals = cells.emplace_hint(cells.end(), cell, portals)->second;
+        for (const auto& portal : placed_portals) {
+            heap_bytes += heap_bytes_of(portal);
+        }
+        ++result[node]._cells_count;
+        result[node]._portals_count += portals.size();
+        ++rank;
+    }
+
+    // The GUID index points to the Portals
+    _guids.clear();
+    for (const auto& [cell, portals] : _cells) {
+        for (const auto& portal : portals) {
+            _memory->_portals.discharge(heap_bytes_of(portal));
+        }
+    }
+    _cells.swap(cells);
+    _memory->_portals.charge(heap_bytes);
+    for (const auto& [cell, portals] : _cells) {
+        for (const auto& portal : portals) {
+            _guids.emplace(portal._guid, location_t { cell, &portal });
+        }
+    }
+    _node_bounds = std::move(node_bounds);
+    _placed = true;
+
+    for (size_t node = 0; node < nodes_count; ++node) {
+        result[node]._bytes = placement.bytes_on(node);
+    }
+    return result;
+}
+
+uint64_t index_t::digest() const {
+    fnv1a_t hasher;
+    update(hasher, _cells);
+    update(hasher, _cells_containing_keys);
+    return hasher.value();
+}
+
+const portal_t* index_t::find(const std::string& guid) const {
+    const auto it = _guids.find(guid);
+    return _guids.end() == it ? nullptr : it->second._portal;
+}
+
+} // namespace ingress_drone_explorer
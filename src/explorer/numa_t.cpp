@@ -0,0 +1,204 @@
+#include "explorer/numa_t.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#   include <sched.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+#if defined(__linux__)
+
+// Constants of mbind from linux/mempolicy.h, which is not always installed
+constexpr int _mpol_bind = 2;
+constexpr unsigned _mpol_mf_move = 1 << 1;
+
+// Lists like "0-3,8,10-11"
+std::vector<int> parse_list(const std::string& text) {
+    std::vector<int> result;
+    std::stringstream stream(text);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        const auto separator = range.find('-');
+        try {
+            const auto first = std::stoi(range.substr(0, separator));
+            const auto last = std::string::npos == separator ? first : std::stoi(range.substr(separator + 1));
+            for (auto value = first; value <= last; ++value) {
+                result.push_back(value);
+            }
+        } catch (const std::exception&) {
+            // Skip the empty and malformed ranges
+        }
+    }
+    return result;
+}
+
+std::string read_line_of(const std::filesystem::path& path) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+#endif
+
+} // namespace
+
+const numa_t& numa_t::topology() {
+    static const numa_t instance;
+    return instance;
+}
+
+numa_t::numa_t() {
+#if defined(__linux__)
+    const std::filesystem::path root("/sys/devices/system/node");
+    for (const auto id : parse_list(read_line_of(root / "has_memory"))) {
+        node_t node;
+        node._id = id;
+        node._cpus = parse_list(read_line_of(root / ("node" + std::to_string(id)) / "cpulist"));
+        _nodes.push_back(std::move(node));
+    }
+#endif
+    if (_nodes.empty()) {
+        _nodes.emplace_back();
+    }
+}
+
+bool numa_t::pin_to(const size_t node) const {
+#if defined(__linux__)
+    const auto& cpus = _nodes.at(node)._cpus;
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+bool numa_t::bind(void* address, const size_t size, const size_t node) const {
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr size_t bits = 8 * sizeof(unsigned long);
+    const auto id = static_cast<size_t>(_nodes.at(node)._id);
+    std::vector<unsigned long> mask(id / bits + 1, 0);
+    mask[id / bits] |= 1UL << (id % bits);
+    return syscall(SYS_mbind, address, size, _mpol_bind, mask.data(), mask.size() * bits + 1, _mpol_mf_move) == 0;
+#else
+    return false;
+#endif
+}
+
+// Hands out the chunks bound to one node in order, the pool on it reuses the freed blocks
+class numa_resource_t::arena_t : public std::pmr::memory_resource {
+public:
+    inline arena_t(numa_resource_t& owner, const size_t node) : _owner(owner), _node(node) { }
+
+    ~arena_t() {
+        for (const auto& [begin, size] : _chunks) {
+            _owner._upstream->deallocate(begin, size, _page_size);
+        }
+    }
+
+    inline size_t bytes() const {
+        return _bytes;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        auto offset = (_offset + alignment - 1) / alignment * alignment;
+        if (_chunks.empty() || offset + bytes > _chunks.back().second) {
+            const auto size = std::max(_chunk_size, (bytes + alignment + _page_size - 1) / _page_size * _page_size);
+            auto* chunk = static_cast<char*>(_owner._upstream->allocate(size, _page_size));
+            _chunks.emplace_back(chunk, size);
+            _bytes += size;
+            // Before touching, so the pages are faulted in on the node
+            if (!numa_t::topology().bind(chunk, size, _node)) {
+                _owner._bound = false;
+            }
+            _owner._chunks.emplace(chunk + size, std::make_pair(chunk, _node));
+            offset = 0;
+        }
+        auto* pointer = _chunks.back().first + offset;
+        _offset = offset + bytes;
+        return pointer;
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {
+        // Kept until destruction
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    numa_resource_t&                        _owner;
+    const size_t                            _node;
+    std::vector<std::pair<char*, size_t>>   _chunks;
+    // Used bytes of the last chunk
+    size_t                                  _offset = 0;
+    size_t                                  _bytes = 0;
+};
+
+numa_resource_t::numa_resource_t(std::pmr::memory_resource* upstream) : _upstream(upstream) { }
+
+numa_resource_t::~numa_resource_t() {
+    // The pools release to the arenas
+    _pools.clear();
+    _arenas.clear();
+}
+
+void numa_resource_t::place() {
+    if (placing()) {
+        return;
+    }
+    const auto count = numa_t::topology().nodes().size();
+    for (size_t node = 0; node < count; ++node) {
+        _arenas.push_back(std::make_unique<arena_t>(*this, node));
+        _pools.push_back(std::make_unique<pool_t>(_arenas.back().get()));
+    }
+}
+
+size_t numa_resource_t::bytes_on(const size_t node) const {
+    return node < _arenas.size() ? _arenas[node]->bytes() : 0;
+}
+
+void* numa_resource_t::do_allocate(size_t bytes, size_t alignment) {
+    if (!placing()) {
+        return _upstream->allocate(bytes, alignment);
+    }
+    return _pools[std::min(_node, _pools.size() - 1)]->allocate(bytes, alignment);
+}
+
+void numa_resource_t::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+    // Allocated before placing if not in any chunk
+    const auto* address = static_cast<const char*>(pointer);
+    const auto it = _chunks.upper_bound(address);
+    if (_chunks.end() == it || address < it->second.first) {
+        _upstream->deallocate(pointer, bytes, alignment);
+        return;
+    }
+    _pools[it->second.second]->deallocate(pointer, bytes, alignment);
+}
+
+bool numa_resource_t::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+} // namespace ingress_drone_explorer
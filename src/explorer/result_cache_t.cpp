@@ -0,0 +1,198 @@
+#include "explorer/result_cache_t.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "utils/fnv1a.hpp"
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+// Bump on any change of the layout
+constexpr char _magic[8] = { 'I', 'D', 'E', 'R', 'C', 'H', 'E', '1' };
+constexpr const char* _extension = ".cells";
+
+// Ordered as the cells themselves, so the deltas of sorted cells are small
+inline uint64_t pack(const s2::cell_t& cell) {
+    return (uint64_t(cell._face) << 61) | (uint64_t(cell._level) << 56) | (uint64_t(cell._i) << 28) | uint64_t(cell._j);
+}
+
+inline s2::cell_t unpack(const uint64_t value) {
+    constexpr uint64_t mask = (uint64_t(1) << 28) - 1;
+    return {
+        static_cast<uint8_t>(value >> 61),
+        static_cast<int32_t>((value >> 28) & mask),
+        static_cast<int32_t>(value & mask),
+        static_cast<uint8_t>((value >> 56) & 0x1F),
+    };
+}
+
+inline void write_varint(std::ostream& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.put(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.put(static_cast<char>(value));
+}
+
+inline bool read_varint(std::istream& in, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        const auto byte = in.get();
+        if (byte == std::istream::traits_type::eof()) {
+            return false;
+        }
+        value |= uint64_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void write_cells(std::ostream& out, const std::vector<s2::cell_t>& cells) {
+    write_varint(out, cells.size());
+    uint64_t previous = 0;
+    for (const auto& cell : cells) {
+        const auto value = pack(cell);
+        write_varint(out, value - previous);
+        previous = value;
+    }
+}
+
+bool read_cells(std::istream& in, std::vector<s2::cell_t>& cells) {
+    uint64_t count = 0;
+    if (!read_varint(in, count)) {
+        return false;
+    }
+    cells.clear();
+    uint64_t value = 0;
+    for (uint64_t index = 0; index < count; ++index) {
+        uint64_t delta = 0;
+        if (!read_varint(in, delta)) {
+            return false;
+        }
+        value += delta;
+        cells.push_back(unpack(value));
+    }
+    return true;
+}
+
+} // namespace
+
+result_cache_t::result_cache_t(const std::filesystem::path& directory, const uintmax_t size_limit)
+    : _directory(directory), _size_limit(size_limit) {
+    std::filesystem::create_directories(_directory);
+}
+
+std::optional<std::vector<s2::cell_t>> result_cache_t::find(
+    const uint64_t digest, const std::vector<s2::cell_t>& start_cells
+) const {
+    const auto path = path_of(digest, start_cells);
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return std::nullopt;
+    }
+    // Verify the key in case of collisions of the file names
+    char magic[sizeof(_magic)];
+    uint64_t stored_digest = 0;
+    std::vector<s2::cell_t> stored_start_cells;
+    std::vector<s2::cell_t> cells;
+    if (
+        !in.read(magic, sizeof(magic))
+        || std::memcmp(magic, _magic, sizeof(_magic)) != 0
+        || !in.read(reinterpret_cast<char*>(&stored_digest), sizeof(stored_digest))
+        || stored_digest != digest
+        || !read_cells(in, stored_start_cells)
+        || stored_start_cells != start_cells
+        || !read_cells(in, cells)
+    ) {
+        return std::nullopt;
+    }
+    // Mark as recently used, fine to fail if removed by another process meanwhile
+    std::error_code error;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+    return cells;
+}
+
+void result_cache_t::store(
+    const uint64_t digest, const std::vector<s2::cell_t>& start_cells, const std::vector<s2::cell_t>& cells
+) const {
+    const auto path = path_of(digest, start_cells);
+    std::random_device random;
+    auto temporary_path = path;
+    temporary_path += "." + std::to_string(random()) + ".tmp";
+    {
+        std::ofstream out(temporary_path, std::ios::binary | std::ios::trunc);
+        out.write(_magic, sizeof(_magic));
+        out.write(reinterpret_cast<const char*>(&digest), sizeof(digest));
+        write_cells(out, start_cells);
+        write_cells(out, cells);
+        if (!out) {
+            out.close();
+            std::error_code error;
+            std::filesystem::remove(temporary_path, error);
+            throw std::runtime_error("Unable to write result cache file.");
+        }
+    }
+    std::filesystem::rename(temporary_path, path);
+    evict();
+}
+
+std::filesystem::path result_cache_t::path_of(
+    const uint64_t digest, const std::vector<s2::cell_t>& start_cells
+) const {
+    fnv1a_t hasher;
+    hasher.update(digest);
+    for (const auto& cell : start_cells) {
+        hasher.update(pack(cell));
+    }
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hasher.value() << _extension;
+    return _directory / name.str();
+}
+
+void result_cache_t::evict() const {
+    struct entry_t {
+        std::filesystem::path           _path;
+        std::filesystem::file_time_type _time;
+        uintmax_t                       _size;
+    };
+    std::vector<entry_t> entries;
+    uintmax_t total_size = 0;
+    std::error_code error;
+    for (const auto& item : std::filesystem::directory_iterator(_directory, error)) {
+        if (item.path().extension() != _extension) {
+            continue;
+        }
+        // Skip the entries removed by other processes meanwhile
+        const auto time = item.last_write_time(error);
+        if (error) {
+            continue;
+        }
+        const auto size = item.file_size(error);
+        if (error) {
+            continue;
+        }
+        entries.push_back({ item.path(), time, size });
+        total_size += size;
+    }
+    if (total_size <= _size_limit) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a._time < b._time; });
+    for (const auto& entry : entries) {
+        if (total_size <= _size_limit) {
+            break;
+        }
+        std::filesystem::remove(entry._path, error);
+        total_size -= entry._size;
+    }
+}
+
+} // namespace ingress_drone_explorer
@@ -0,0 +1,173 @@
+#include "explorer/index_t.hpp"
+
+#include <algorithm>
+#include <numbers>
+
+namespace ingress_drone_explorer {
+
+namespace {
+
+// Key Portals sorted by latitude, to find the ones possibly within the radius by a binary search.
+class key_sweep_t {
+public:
+    key_sweep_t(const index_t::cell_portals_map_t& cells_containing_keys, const double radius) {
+        for (const auto& [cell, portals] : cells_containing_keys) {
+            for (const auto& portal : portals) {
+                _keys.push_back({ portal._coordinate, cell });
+            }
+        }
+        std::sort(_keys.begin(), _keys.end(), [](const auto& a, const auto& b) {
+            return a._coordinate._lat < b._coordinate._lat;
+        });
+        _radius = radius;
+        // The distance is never shorter than the one along the meridian, leave a margin for the rounding
+        _latitude_window = radius / 6371008.8 / std::numbers::pi * 180.0 * 1.01;
+    }
+
+    template<typename callback_t>
+    void for_each_key_near(const coordinate_t& coordinate, const callback_t& callback) const {
+        auto it = std::lower_bound(
+            _keys.begin(), _keys.end(), coordinate._lat - _latitude_window,
+            [](const auto& key, const double lat) { return key._coordinate._lat < lat; }
+        );
+        for (; it != _keys.end() && it->_coordinate._lat <= coordinate._lat + _latitude_window; ++it) {
+            if (coordinate.distance_to(it->_coordinate) < _radius) {
+                callback(it->_cell);
+            }
+        }
+    }
+
+private:
+    struct key_t {
+        coordinate_t    _coordinate;
+        s2::cell_t      _cell;
+    };
+
+    std::vector<key_t>  _keys;
+    double              _radius;
+    double              _latitude_window;
+};
+
+} // namespace
+
+void index_t::summarize() {
+    _summaries.clear();
+    _edges.clear();
+
+    const key_sweep_t key_sweep(_cells_containing_keys, _reachable_radius_with_key);
+    constexpr int32_t safe_rounds_for_visible_radius = (_visible_radius / 80) + 1;
+
+    std::map<s2::cell_t, std::vector<s2::cell_t>> children_of;
+    for (const auto& entry : _cells) {
+        children_of[parent_of(entry.first)].push_back(entry.first);
+    }
+
+    for (const auto& [parent, children] : children_of) {
+        // Same edges as the flat exploration: a populated cell in the visible range of any Portal, or containing a
+        // Key within the reachable range of any Portal.
+        std::vector<std::vector<size_t>> inner_edges(children.size());
+        std::vector<std::set<s2::cell_t>> outer_candidates(children.size());
+        for (size_t index = 0; index < children.size(); ++index) {
+            const auto& cell = children[index];
+            const auto& portals = _cells.at(cell);
+            std::set<s2::cell_t> reachable;
+            for (const auto& portal : portals) {
+                key_sweep.for_each_key_near(portal._coordinate, [&](const auto& key_cell) {
+                    reachable.insert(key_cell);
+                });
+            }
+            for (const auto& neighbor : cell.neighbored_cells_in(safe_rounds_for_visible_radius)) {
+                if (reachable.contains(neighbor) || !_cells.contains(neighbor)) {
+                    continue;
+                }
+                if (parent_of(neighbor) != parent) {
+                    // Test later, only once for all the children if the parent is connected
+                    outer_candidates[index].insert(neighbor);
+                    continue;
+                }
+                for (const auto& portal : portals) {
+                    if (neighbor.intersects_with_cap_of(portal._coordinate, _visible_radius)) {
+                        reachable.insert(neighbor);
+                        break;
+                    }
+                }
+            }
+            for (const auto& target : reachable) {
+                if (target == cell) {
+                    continue;
+                }
+                if (parent_of(target) == parent) {
+                    const auto it = std::lower_bound(children.begin(), children.end(), target);
+                    inner_edges[index].push_back(it - children.begin());
+                } else {
+                    outer_candidates[index].erase(target);
+                    _edges[cell].push_back(target);
+                }
+            }
+        }
+
+        // Connected if all the children are reachable from the first one and vice versa
+        const auto reaches_all = [&](const std::vector<std::vector<size_t>>& edges) {
+            std::vector<bool> visited(children.size(), false);
+            std::vector<size_t> stack { 0 };
+            visited[0] = true;
+            size_t visited_count = 1;
+            while (!stack.empty()) {
+                const auto index = stack.back();
+                stack.pop_back();
+                for (const auto target : edges[index]) {
+                    if (!visited[target]) {
+                        visited[target] = true;
+                        ++visited_count;
+                        stack.push_back(target);
+                    }
+                }
+            }
+            return visited_count == children.size();
+        };
+        std::vector<std::vector<size_t>> reversed_edges(children.size());
+        for (size_t index = 0; index < children.size(); ++index) {
+            for (const auto target : inner_edges[index]) {
+                reversed_edges[target].push_back(index);
+            }
+        }
+        auto& summary = _summaries[parent];
+        summary._cells.assign(children.begin(), children.end());
+        summary._connected = reaches_all(inner_edges) && reaches_all(reversed_edges);
+
+        std::set<s2::cell_t> exits;
+        for (size_t index = 0; index < children.size(); ++index) {
+            const auto& cell = children[index];
+            const auto& portals = _cells.at(cell);
+            auto& edges = _edges[cell];
+            if (summary._connected) {
+                exits.insert(edges.begin(), edges.end());
+            }
+            for (const auto& neighbor : outer_candidates[index]) {
+                if (summary._connected && exits.contains(neighbor)) {
+                    continue;
+                }
+                for (const auto& portal : portals) {
+                    if (neighbor.intersects_with_cap_of(portal._coordinate, _visible_radius)) {
+                        if (summary._connected) {
+                            exits.insert(neighbor);
+                        } else {
+                            edges.push_back(neighbor);
+                        }
+                        break;
+                    }
+                }
+            }
+            if (summary._connected) {
+                _edges.erase(cell);
+            } else {
+                for (const auto target : inner_edges[index]) {
+                    edges.push_back(children[target]);
+                }
+            }
+        }
+        summary._exits.assign(exits.begin(), exits.end());
+    }
+}
+
+} // namespace ingress_drone_explorer
@@ -4,6 +4,7 @@
 
 #include "definitions/drawn_item_t.hpp"
 #include "definitions/portal_t.hpp"
+#include "s2/cell_t.hpp"
 
 namespace ingress_drone_explorer {
 
@@ -47,4 +48,25 @@ void tag_invoke(const boost::json::value_from_tag&, boost::json::value& value, c
     };
 }
 
+void tag_invoke(const boost::json::value_from_tag&, boost::json::value& value, const portal_t& tag) {
+    value = {
+        { "guid", tag._guid },
+        { "title", tag._title },
+        { "lngLat", boost::json::value_from(tag._coordinate) }
+    };
+}
+
+namespace s2 {
+
+void tag_invoke(const boost::json::value_from_tag&, boost::json::value& value, const cell_t& tag) {
+    value = {
+        { "face", tag._face },
+        { "level", tag._level },
+        { "i", tag._i },
+        { "j", tag._j }
+    };
+}
+
+} // namespace s2
+
 } // namespace ingress_drone_explorer
\ No newline at end of file
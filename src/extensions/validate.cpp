@@ -7,24 +7,40 @@
 
 namespace ingress_drone_explorer {
 
-void validate(boost::any& v, const std::vector<std::string>& values, coordinate_t*, int) {
-    boost::program_options::validators::check_first_occurrence(v);
-    const auto& value = boost::program_options::validators::get_single_string(values);
+bool parse(const std::string& value, coordinate_t& coordinate) {
     std::vector<std::string> components;
     boost::algorithm::split(components, value, boost::is_any_of(","));
     if (components.size() != 2 || components[0].empty() || components[1].empty()) {
-        throw boost::program_options::validation_error(
-            boost::program_options::validation_error::kind_t::invalid_option_value
-        );
+        return false;
+    }
+    double lng, lat;
+    try {
+        size_t lng_length, lat_length;
+        lng = std::stod(components[0], &lng_length);
+        lat = std::stod(components[1], &lat_length);
+        if (lng_length != components[0].size() || lat_length != components[1].size()) {
+            return false;
+        }
+    } catch (const std::logic_error&) {
+        return false;
     }
-    const auto lng = std::stod(components[0]);
-    const auto lat = std::stod(components[1]);
-    if (std::abs(lng) > 180 || std::abs(lat) > 90) {
+    if (!(std::abs(lng) <= 180 && std::abs(lat) <= 90)) {
+        return false;
+    }
+    coordinate = coordinate_t(lng, lat);
+    return true;
+}
+
+void validate(boost::any& v, const std::vector<std::string>& values, coordinate_t*, int) {
+    boost::program_options::validators::check_first_occurrence(v);
+    const auto& value = boost::program_options::validators::get_single_string(values);
+    coordinate_t coordinate;
+    if (!parse(value, coordinate)) {
         throw boost::program_options::validation_error(
             boost::program_options::validation_error::kind_t::invalid_option_value
         );
     }
-    v = boost::any(coordinate_t(lng, lat));
+    v = boost::any(coordinate);
 }
 
 } // namespace ingress_drone_explorer
\ No newline at end of file
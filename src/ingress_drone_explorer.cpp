@@ -0,0 +1,251 @@
+#include "ingress_drone_explorer.h"
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "explorer/context_t.hpp"
+#include "explorer/index_t.hpp"
+#include "explorer/numa_t.hpp"
+
+using namespace ingress_drone_explorer;
+
+struct ide_index_t {
+    index_t _index;
+};
+
+struct ide_context_t {
+    const index_t&                  _index;
+    context_t                       _context;
+    // Keep the results alive for the pointers returned
+    report_t                        _report;
+    key_analysis_t                  _key_analysis;
+    std::vector<ide_key_impact_t>   _impacts;
+    search_result_t                 _search_result;
+    std::vector<ide_hop_t>          _hops;
+
+    inline explicit ide_context_t(const index_t& index) : _index(index), _context(index) { }
+};
+
+namespace {
+
+thread_local std::string last_error;
+
+template<typename function_t>
+inline int guarded(const function_t& function) {
+    try {
+        function();
+    } catch (const std::exception& e) {
+        last_error = e.what();
+        return -1;
+    } catch (...) {
+        last_error = "Unknown error occured.";
+        return -1;
+    }
+    return 0;
+}
+
+inline ide_portal_t portal_of(const portal_t& portal) {
+    return { portal._guid.c_str(), portal._title.c_str(), portal._coordinate._lng, portal._coordinate._lat };
+}
+
+inline ide_cell_t cell_of(const s2::cell_t& cell) {
+    return { cell._face, cell._level, cell._i, cell._j };
+}
+
+void search(
+    ide_context_t* context,
+    const coordinate_t& start, const s2::cell_t& target_cell, const coordinate_t& target,
+    ide_search_result_t* result
+) {
+    context->_search_result = context->_context.search_from(start, target_cell, target);
+    const auto& search_result = context->_search_result;
+    context->_hops.clear();
+    for (const auto& hop : search_result._hops) {
+        context->_hops.push_back({
+            cell_of(hop._cell),
+            portal_of(hop._portal),
+            hop._key ? portal_of(*hop._key) : ide_portal_t { nullptr, nullptr, 0, 0 },
+        });
+    }
+    *result = {
+        search_result._found ? 1 : 0,
+        search_result._discovered_cells_count,
+        context->_hops.data(),
+        context->_hops.size(),
+    };
+}
+
+} // namespace
+
+const char* ide_last_error(void) {
+    return last_error.c_str();
+}
+
+ide_index_t* ide_index_create(void) {
+    ide_index_t* index = nullptr;
+    guarded([&] { index = new ide_index_t; });
+    return index;
+}
+
+void ide_index_destroy(ide_index_t* index) {
+    delete index;
+}
+
+int ide_index_load_portals(ide_index_t* index, const char* const* filenames, size_t count) {
+    return guarded([&] {
+        index->_index.load_portals({ filenames, filenames + count });
+    });
+}
+
+int ide_index_load_keys(ide_index_t* index, const char* filename) {
+    return guarded([&] {
+        index->_index.load_keys(filename);
+    });
+}
+
+size_t ide_index_portals_count(const ide_index_t* index) {
+    return index->_index.portals_count();
+}
+
+int ide_index_summarize(ide_index_t* index) {
+    return guarded([&] {
+        index->_index.summarize();
+    });
+}
+
+int ide_index_place_on_nodes(ide_index_t* index) {
+    return guarded([&] {
+        index->_index.place_on_nodes();
+    });
+}
+
+size_t ide_index_node_of(const ide_index_t* index, double lng, double lat) {
+    return index->_index.node_of(s2::cell_t(coordinate_t(lng, lat)));
+}
+
+size_t ide_numa_nodes_count(void) {
+    return numa_t::topology().nodes().size();
+}
+
+int ide_numa_pin_thread_to(size_t node) {
+    return guarded([&] {
+        if (node >= numa_t::topology().nodes().size() || !numa_t::topology().pin_to(node)) {
+            throw std::runtime_error("Unable to pin the thread to the node.");
+        }
+    });
+}
+
+ide_context_t* ide_context_create(const ide_index_t* index) {
+    ide_context_t* context = nullptr;
+    guarded([&] { context = new ide_context_t(index->_index); });
+    return context;
+}
+
+void ide_context_destroy(ide_context_t* context) {
+    delete context;
+}
+
+int ide_context_explore_from(ide_context_t* context, double lng, double lat) {
+    return guarded([&] {
+        context->_context.explore_from({ lng, lat });
+    });
+}
+
+int ide_context_report(ide_context_t* context, ide_report_t* report) {
+    return guarded([&] {
+        context->_report = context->_context.report();
+        const auto& result = context->_report;
+        const auto found = result._reachable_portals_count > 0;
+        *report = {
+            result._cells_count,
+            result._reachable_cells_count,
+            result._portals_count,
+            result._reachable_portals_count,
+            found ? result._furthest_portal._guid.c_str() : nullptr,
+            found ? result._furthest_portal._title.c_str() : nullptr,
+            result._furthest_portal._coordinate._lng,
+            result._furthest_portal._coordinate._lat,
+            result._furthest_distance,
+        };
+    });
+}
+
+int ide_context_analyze_radii(
+    ide_context_t* context, double lng, double lat, const double* radii, size_t count,
+    ide_radius_reachability_t* results
+) {
+    return guarded([&] {
+        const auto reachabilities = context->_context.analyze_radii_from({ lng, lat }, { radii, radii + count });
+        for (size_t index = 0; index < reachabilities.size(); ++index) {
+            const auto& reachability = reachabilities[index];
+            results[index] = {
+                reachability._radius,
+                reachability._reachable_cells_count,
+                reachability._reachable_portals_count,
+            };
+        }
+    });
+}
+
+int ide_context_analyze_keys(ide_context_t* context, double lng, double lat, ide_key_analysis_t* analysis) {
+    return guarded([&] {
+        context->_key_analysis = context->_context.analyze_keys_from({ lng, lat });
+        const auto& key_analysis = context->_key_analysis;
+        context->_impacts.clear();
+        for (const auto& impact : key_analysis._impacts) {
+            context->_impacts.push_back({
+                portal_of(impact._portal),
+                impact._alone_cells_count,
+                impact._alone_portals_count,
+                impact._marginal_cells_count,
+                impact._marginal_portals_count,
+            });
+        }
+        *analysis = {
+            key_analysis._base_reachable_cells_count,
+            key_analysis._base_reachable_portals_count,
+            key_analysis._reachable_cells_count,
+            key_analysis._reachable_portals_count,
+            context->_impacts.data(),
+            context->_impacts.size(),
+        };
+    });
+}
+
+int ide_context_search_to_portal(
+    ide_context_t* context, double lng, double lat, const char* target_guid, ide_search_result_t* result
+) {
+    return guarded([&] {
+        const auto portal = context->_index.find(target_guid);
+        if (!portal) {
+            throw std::runtime_error("Unable to find the target Portal.");
+        }
+        search(context, { lng, lat }, s2::cell_t(portal->_coordinate), portal->_coordinate, result);
+    });
+}
+
+int ide_context_search_to_coordinate(
+    ide_context_t* context, double lng, double lat, double target_lng, double target_lat, ide_search_result_t* result
+) {
+    return guarded([&] {
+        const coordinate_t target(target_lng, target_lat);
+        const auto target_cell = s2::cell_t(target);
+        if (!context->_index.cells().contains(target_cell)) {
+            throw std::runtime_error("There is no Portal in the target cell.");
+        }
+        search(context, { lng, lat }, target_cell, target, result);
+    });
+}
+
+size_t ide_context_reachable_cells(const ide_context_t* context, ide_cell_t* cells, size_t capacity) {
+    const auto& reachable_cells = context->_context.reachable_cells();
+    if (cells) {
+        size_t index = 0;
+        for (auto it = reachable_cells.begin(); it != reachable_cells.end() && index < capacity; ++it, ++index) {
+            cells[index] = { it->_face, it->_level, it->_i, it->_j };
+        }
+    }
+    return reachable_cells.size();
+}
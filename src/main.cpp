@@ -15,10 +15,10 @@ int main(int argc, char* argv[]) {
     try {
         ingress_drone_explorer::command::execute(argc, argv);
     } catch (const std::exception& e) {
-        std::cout << e.what() << std::endl;
+        std::cerr << e.what() << std::endl;
         return 1;
     } catch (...) {
-        std::cout << "❓ Unknown error occured." << std::endl;
+        std::cerr << "❓ Unknown error occured." << std::endl;
         return 1;
     }
     return 0;
@@ -0,0 +1,184 @@
+#include "s2/batch.hpp"
+
+#include <numbers>
+
+#include "definitions/coordinate_t.hpp"
+#include "s2/trigonometry.hpp"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#   define S2_BATCH_AVX2
+#   include <immintrin.h>
+#endif
+
+namespace ingress_drone_explorer {
+
+namespace s2 {
+
+#if defined(S2_BATCH_AVX2)
+
+namespace {
+
+#define S2_BATCH_TARGET __attribute__((target("avx2")))
+
+S2_BATCH_TARGET inline __m256d set(const double value) {
+    return _mm256_set1_pd(value);
+}
+
+S2_BATCH_TARGET inline __m256d add(const __m256d a, const __m256d b) {
+    return _mm256_add_pd(a, b);
+}
+
+S2_BATCH_TARGET inline __m256d sub(const __m256d a, const __m256d b) {
+    return _mm256_sub_pd(a, b);
+}
+
+S2_BATCH_TARGET inline __m256d mul(const __m256d a, const __m256d b) {
+    return _mm256_mul_pd(a, b);
+}
+
+// Mirrors s2::sin_cos, every operation should be kept in the same order.
+S2_BATCH_TARGET inline void sin_cos(const __m256d x, __m256d& sin, __m256d& cos) {
+    using namespace trigonometry;
+
+    const auto shifted = add(mul(x, set(_2_over_pi)), set(_round_shift));
+    const auto q = sub(shifted, set(_round_shift));
+    const auto r = sub(
+        sub(sub(x, mul(q, set(_pi_over_2_1))), mul(q, set(_pi_over_2_2))), mul(q, set(_pi_over_2_2t))
+    );
+
+    const auto z = mul(r, r);
+    const auto v = mul(z, r);
+    auto horner = add(set(_s5), mul(z, set(_s6)));
+    horner = add(set(_s4), mul(z, horner));
+    horner = add(set(_s3), mul(z, horner));
+    horner = add(set(_s2), mul(z, horner));
+    const auto s = add(r, mul(v, add(set(_s1), mul(z, horner))));
+    const auto w = mul(z, z);
+    const auto p = add(
+        mul(z, add(set(_c1), mul(z, add(set(_c2), mul(z, set(_c3)))))),
+        mul(mul(w, w), add(set(_c4), mul(z, add(set(_c5), mul(z, set(_c6))))))
+    );
+    const auto h = mul(set(0.5), z);
+    const auto one_h = sub(set(1.0), h);
+    const auto c = add(one_h, add(sub(sub(set(1.0), one_h), h), mul(z, p)));
+
+    const auto quadrant = _mm256_castpd_si256(shifted);
+    const auto one = _mm256_set1_epi64x(1);
+    const auto two = _mm256_set1_epi64x(2);
+    const auto swap = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(quadrant, one), one));
+    // Move bit 1 of the quadrant to the sign bit
+    const auto sin_sign = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_and_si256(quadrant, two), 62));
+    const auto cos_sign = _mm256_castsi256_pd(
+        _mm256_slli_epi64(_mm256_and_si256(_mm256_add_epi64(quadrant, one), two), 62)
+    );
+    sin = _mm256_xor_pd(_mm256_blendv_pd(s, c, swap), sin_sign);
+    cos = _mm256_xor_pd(_mm256_blendv_pd(c, s, swap), cos_sign);
+}
+
+// Pick the value of face 0, 1 or 2 by the masks, faces 3 to 5 share the masks with 0 to 2.
+S2_BATCH_TARGET inline __m256d select(
+    const __m256d face_0, const __m256d face_1, const __m256d on_0, const __m256d on_1, const __m256d on_2
+) {
+    return _mm256_blendv_pd(_mm256_blendv_pd(on_2, on_1, face_1), on_0, face_0);
+}
+
+// Mirrors the (u, v) to (s, t) transformation in face_s_t.
+S2_BATCH_TARGET inline __m256d st_of(const __m256d uv) {
+    const auto positive = _mm256_cmp_pd(uv, _mm256_setzero_pd(), _CMP_GE_OQ);
+    const auto three_uv = mul(set(3), uv);
+    const auto upper = mul(set(0.5), _mm256_sqrt_pd(add(set(1), three_uv)));
+    const auto lower = sub(set(1.0), mul(set(0.5), _mm256_sqrt_pd(sub(set(1), three_uv))));
+    return _mm256_blendv_pd(lower, upper, positive);
+}
+
+S2_BATCH_TARGET inline __m128i index_of(const __m256d st, const int32_t max) {
+    const auto floored = _mm256_cvttpd_epi32(_mm256_floor_pd(mul(st, set(max))));
+    return _mm_min_epi32(_mm_max_epi32(floored, _mm_setzero_si128()), _mm_set1_epi32(max - 1));
+}
+
+// Mirrors ecef_coordinate_t and face_s_t, the face selection branches become masks.
+S2_BATCH_TARGET void cells_of_avx2(
+    const double* lngs, const double* lats, const size_t count, const uint8_t level, std::vector<cell_t>& cells
+) {
+    const auto sign = set(-0.0);
+    const int32_t max = 1 << level;
+
+    alignas(16) int32_t is[4];
+    alignas(16) int32_t js[4];
+    for (size_t index = 0; index < count; index += 4) {
+        const auto theta = _mm256_div_pd(mul(_mm256_loadu_pd(lngs + index), set(std::numbers::pi)), set(180.0));
+        const auto phi = _mm256_div_pd(mul(_mm256_loadu_pd(lats + index), set(std::numbers::pi)), set(180.0));
+        __m256d sin_theta, cos_theta, sin_phi, cos_phi;
+        sin_cos(theta, sin_theta, cos_theta);
+        sin_cos(phi, sin_phi, cos_phi);
+        const auto x = mul(cos_theta, cos_phi);
+        const auto y = mul(sin_theta, cos_phi);
+        const auto z = sin_phi;
+
+        const auto abs_x = _mm256_andnot_pd(sign, x);
+        const auto abs_y = _mm256_andnot_pd(sign, y);
+        const auto abs_z = _mm256_andnot_pd(sign, z);
+        const auto x_over_y = _mm256_cmp_pd(abs_x, abs_y, _CMP_GT_OQ);
+        const auto face_0 = _mm256_and_pd(x_over_y, _mm256_cmp_pd(abs_x, abs_z, _CMP_GT_OQ));
+        const auto face_1 = _mm256_andnot_pd(x_over_y, _mm256_cmp_pd(abs_y, abs_z, _CMP_GT_OQ));
+        const auto denominator = select(face_0, face_1, x, y, z);
+        const auto negative = _mm256_cmp_pd(denominator, _mm256_setzero_pd(), _CMP_LT_OQ);
+        const auto neg_x = _mm256_xor_pd(x, sign);
+        const auto neg_y = _mm256_xor_pd(y, sign);
+        // Faces 0 to 5 in order: s = y, -x, -x, z, z, -y and t = z, z, -y, y, -x, -x
+        const auto y_neg_x = select(face_0, face_1, y, neg_x, neg_x);
+        const auto z_neg_y = select(face_0, face_1, z, z, neg_y);
+        const auto s_numerator = _mm256_blendv_pd(y_neg_x, z_neg_y, negative);
+        const auto t_numerator = _mm256_blendv_pd(z_neg_y, y_neg_x, negative);
+        const auto s = st_of(_mm256_div_pd(s_numerator, denominator));
+        const auto t = st_of(_mm256_div_pd(t_numerator, denominator));
+        _mm_store_si128(reinterpret_cast<__m128i*>(is), index_of(s, max));
+        _mm_store_si128(reinterpret_cast<__m128i*>(js), index_of(t, max));
+
+        const auto face_0_bits = _mm256_movemask_pd(face_0);
+        const auto face_1_bits = _mm256_movemask_pd(face_1);
+        const auto negative_bits = _mm256_movemask_pd(negative);
+        for (int lane = 0; lane < 4; ++lane) {
+            const auto bit = 1 << lane;
+            uint8_t face = (face_0_bits & bit) ? 0 : ((face_1_bits & bit) ? 1 : 2);
+            if (negative_bits & bit) {
+                face += 3;
+            }
+            cells.emplace_back(face, is[lane], js[lane], level);
+        }
+    }
+}
+
+#undef S2_BATCH_TARGET
+
+} // namespace
+
+#endif
+
+void cells_of(
+    const double* lngs, const double* lats, const size_t count, const uint8_t level, std::vector<cell_t>& cells
+) {
+    cells.reserve(cells.size() + count);
+    size_t vectorized = 0;
+#if defined(S2_BATCH_AVX2)
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    if (avx2) {
+        vectorized = count & ~size_t(3);
+        cells_of_avx2(lngs, lats, vectorized, level, cells);
+    }
+#endif
+    cells_of_reference(lngs + vectorized, lats + vectorized, count - vectorized, level, cells);
+}
+
+void cells_of_reference(
+    const double* lngs, const double* lats, const size_t count, const uint8_t level, std::vector<cell_t>& cells
+) {
+    cells.reserve(cells.size() + count);
+    for (size_t index = 0; index < count; ++index) {
+        cells.emplace_back(coordinate_t(lngs[index], lats[index]), level);
+    }
+}
+
+} // namespace s2
+
+} // namespace ingress_drone_explorer
@@ -19,29 +19,13 @@ cell_t::cell_t(const coordinate_t& coordinate, const uint8_t level) {
     _j = std::clamp(static_cast<decltype(_j)>(std::floor(t * max)), 0, max - 1);
 }
 
-inline cell_t::cell_t(const uint8_t face, const int32_t i, const int32_t j, uint8_t level) {
-    _level = level;
-    const int32_t max = 1 << level;
-    if (i >= 0 && j >= 0 && i < max && j < max) {
-        _face = face;
-        _i = i;
-        _j = j;
-        return;
-    }
-    double s, t;
-    ecef_coordinate_t(face, (0.5 + i) / max, (0.5 + j) / max).face_s_t(_face, s, t);
-    _i = std::clamp(static_cast<decltype(_i)>(std::floor(s * max)), 0, max - 1);
-    _j = std::clamp(static_cast<decltype(_j)>(std::floor(t * max)), 0, max - 1);
+double cell_t::distance_to(const coordinate_t& center) const {
+    const auto corners = closest_corners_to(center);
+    return std::min(center.distance_to(corners[0]), center.distance_to(corners[0], corners[1]));
 }
 
 bool cell_t::intersects_with_cap_of(const coordinate_t& center, const double radius) const {
-    auto corners = shape();
-    std::partial_sort(
-        corners.begin(), corners.begin() + 2U, corners.end(),
-        [&](const auto& a, const auto& b) {
-            return center.closer(a, b);
-        }
-    );
+    const auto corners = closest_corners_to(center);
     return center.distance_to(corners[0]) < radius || center.distance_to(corners[0], corners[1]) < radius;
 }
 
@@ -101,6 +85,17 @@ inline coordinate_t cell_t::coordinate(const double d_i, const double d_j) const
     .coordinate();
 }
 
+inline std::array<coordinate_t, 4> cell_t::closest_corners_to(const coordinate_t& center) const {
+    auto corners = shape();
+    std::partial_sort(
+        corners.begin(), corners.begin() + 2U, corners.end(),
+        [&](const auto& a, const auto& b) {
+            return center.closer(a, b);
+        }
+    );
+    return corners;
+}
+
 inline std::set<cell_t> cell_t::neighbors() const {
     return {
         { _face, _i - 1, _j     , _level },
@@ -0,0 +1,105 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "s2/batch.hpp"
+
+using namespace ingress_drone_explorer;
+
+namespace {
+
+void add(std::vector<double>& lngs, std::vector<double>& lats, const double lng, const double lat) {
+    lngs.push_back(lng);
+    lats.push_back(lat);
+    // The neighbors in floating point, to hit both sides of an edge
+    for (const auto direction : { -1.0, 1.0 }) {
+        lngs.push_back(std::nextafter(lng, lng + direction));
+        lats.push_back(lat);
+        lngs.push_back(lng);
+        lats.push_back(std::nextafter(lat, lat + direction));
+    }
+}
+
+size_t compare(const std::vector<double>& lngs, const std::vector<double>& lats, const uint8_t level) {
+    std::vector<s2::cell_t> cells;
+    std::vector<s2::cell_t> references;
+    s2::cells_of(lngs.data(), lats.data(), lngs.size(), level, cells);
+    s2::cells_of_reference(lngs.data(), lats.data(), lngs.size(), level, references);
+    if (cells.size() != references.size()) {
+        std::cerr << "Got " << cells.size() << " cell(s) instead of " << references.size() << std::endl;
+        return lngs.size();
+    }
+    size_t mismatches = 0;
+    for (size_t index = 0; index < cells.size(); ++index) {
+        if (cells[index] == references[index]) {
+            continue;
+        }
+        if (++mismatches <= 10) {
+            std::cerr.precision(17);
+            std::cerr << "Mismatch at " << lngs[index] << "," << lats[index] << " level " << +level << std::endl;
+        }
+    }
+    return mismatches;
+}
+
+} // namespace
+
+int main() {
+    std::vector<double> lngs;
+    std::vector<double> lats;
+
+    // Poles, the antimeridian and the equator
+    for (const auto lng : { -180.0, -135.0, -90.0, -45.0, 0.0, 45.0, 90.0, 135.0, 180.0 }) {
+        for (const auto lat : { -90.0, -45.0, 0.0, 45.0, 90.0 }) {
+            add(lngs, lats, lng, lat);
+        }
+    }
+    // Face edges: |x| = |y| at longitudes of odd multiples of 45°, |x| = |z| or |y| = |z| where tan(lat) = |cos(lng)|
+    // or |sin(lng)|
+    for (int32_t step = 0; step <= 3600; ++step) {
+        const double lng = -180.0 + step * 0.1;
+        const double theta = lng / 180.0 * std::numbers::pi;
+        for (const auto side : { std::abs(std::cos(theta)), std::abs(std::sin(theta)) }) {
+            const double lat = std::atan(side) / std::numbers::pi * 180.0;
+            add(lngs, lats, lng, lat);
+            add(lngs, lats, lng, -lat);
+        }
+        for (const auto edge : { -135.0, -45.0, 45.0, 135.0 }) {
+            add(lngs, lats, edge, lng / 2.0);
+        }
+    }
+    std::mt19937_64 engine(20221019);
+    // Corners of random cells, on the boundaries of the cells in all the levels up to 16
+    std::uniform_int_distribution<int32_t> face_distribution(0, 5);
+    std::uniform_int_distribution<int32_t> index_distribution(0, (1 << 16) - 1);
+    for (int32_t count = 0; count < 20000; ++count) {
+        const s2::cell_t cell(face_distribution(engine), index_distribution(engine), index_distribution(engine));
+        for (const auto& corner : cell.shape()) {
+            add(lngs, lats, corner._lng, corner._lat);
+        }
+    }
+    // Uniformly random on the sphere
+    std::uniform_real_distribution<double> lng_distribution(-180.0, 180.0);
+    std::uniform_real_distribution<double> z_distribution(-1.0, 1.0);
+    for (int32_t count = 0; count < 200000; ++count) {
+        lngs.push_back(lng_distribution(engine));
+        lats.push_back(std::asin(z_distribution(engine)) / std::numbers::pi * 180.0);
+    }
+    // Odd count to cover the scalar tail
+    lngs.push_back(113.8534);
+    lats.push_back(22.3917);
+
+    size_t mismatches = 0;
+    for (const uint8_t level : { 0, 1, 13, 16, 30 }) {
+        mismatches += compare(lngs, lats, level);
+    }
+    if (mismatches > 0) {
+        std::cerr << mismatches << " mismatch(es) in " << lngs.size() << " coordinate(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "Compared " << lngs.size() << " coordinate(s) in 5 levels" << std::endl;
+    return 0;
+}
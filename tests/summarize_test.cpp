@@ -0,0 +1,131 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "explorer/context_t.hpp"
+#include "explorer/index_t.hpp"
+
+using namespace ingress_drone_explorer;
+
+namespace {
+
+struct fixture_t {
+    std::string                 _portals_filename;
+    std::string                 _keys_filename;
+    std::vector<coordinate_t>   _starts;
+};
+
+// Clusters of Portals, some close enough to connect the parents and some isolated, Keys on a part of them.
+fixture_t generate(const std::filesystem::path& directory) {
+    std::mt19937_64 engine(20221019);
+    std::uniform_real_distribution<double> center_distribution(-0.1, 0.1);
+    std::normal_distribution<double> offset_distribution(0, 0.004);
+    std::bernoulli_distribution key_distribution(0.05);
+
+    fixture_t fixture;
+    fixture._portals_filename = (directory / "portals.json").string();
+    fixture._keys_filename = (directory / "keys.json").string();
+    std::ofstream portals(fixture._portals_filename);
+    std::ofstream keys(fixture._keys_filename);
+    portals.precision(17);
+    portals << "[";
+    keys << "[";
+    size_t count = 0;
+    size_t keys_count = 0;
+    for (int32_t cluster = 0; cluster < 40; ++cluster) {
+        const double center_lng = 113.85 + center_distribution(engine);
+        const double center_lat = 22.39 + center_distribution(engine);
+        fixture._starts.emplace_back(center_lng, center_lat);
+        for (int32_t index = 0; index < 60; ++index) {
+            const auto guid = "portal-" + std::to_string(count);
+            const double lng = center_lng + offset_distribution(engine);
+            const double lat = center_lat + offset_distribution(engine);
+            portals << (count ? "," : "") << R"({"guid":")" << guid << R"(","title":")" << guid << R"(",)"
+                << R"("lngLat":{"lng":)" << lng << R"(,"lat":)" << lat << "}}";
+            if (key_distribution(engine)) {
+                keys << (keys_count++ ? "," : "") << '"' << guid << '"';
+            }
+            if (index == 0) {
+                fixture._starts.emplace_back(lng, lat);
+            }
+            ++count;
+        }
+    }
+    portals << "]";
+    keys << "]";
+    return fixture;
+}
+
+// The depth histogram is only gathered flatly, it should cover each reachable cell once
+bool reports_match(const report_t& flat, const report_t& hierarchical) {
+    size_t depths_count = 0;
+    for (const auto count : flat._depth_histogram) {
+        depths_count += count;
+    }
+    if (depths_count != flat._reachable_cells_count
+        || flat._reachable_cells_count != hierarchical._reachable_cells_count
+        || flat._reachable_portals_count != hierarchical._reachable_portals_count
+        || flat._distance_histogram != hierarchical._distance_histogram
+        || flat._furthest_portals.size() != hierarchical._furthest_portals.size()
+    ) {
+        return false;
+    }
+    for (size_t index = 0; index < flat._furthest_portals.size(); ++index) {
+        if (flat._furthest_portals[index]._distance != hierarchical._furthest_portals[index]._distance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t compare(const fixture_t& fixture, const bool with_keys) {
+    index_t flat;
+    index_t hierarchical;
+    for (auto* index : { &flat, &hierarchical }) {
+        index->load_portals({ fixture._portals_filename });
+        if (with_keys) {
+            index->load_keys(fixture._keys_filename);
+        }
+    }
+    hierarchical.summarize();
+
+    size_t mismatches = 0;
+    for (const auto& start : fixture._starts) {
+        context_t expected(flat);
+        context_t actual(hierarchical);
+        expected.explore_from(start);
+        actual.explore_from(start);
+        if (expected.reachable_cells() != actual.reachable_cells()) {
+            std::cerr << "Mismatch from " << start._lng << "," << start._lat << (with_keys ? " with" : " without")
+                << " Keys: " << actual.reachable_cells().size() << " cell(s) instead of "
+                << expected.reachable_cells().size() << std::endl;
+            ++mismatches;
+        } else if (!reports_match(expected.report(), actual.report())) {
+            std::cerr << "Report mismatch from " << start._lng << "," << start._lat
+                << (with_keys ? " with" : " without") << " Keys" << std::endl;
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+} // namespace
+
+int main() {
+    const auto directory = std::filesystem::temp_directory_path() / "ingress_drone_explorer_summarize_test";
+    std::filesystem::create_directories(directory);
+    const auto fixture = generate(directory);
+
+    const auto mismatches = compare(fixture, false) + compare(fixture, true);
+    std::filesystem::remove_all(directory);
+    if (mismatches > 0) {
+        std::cerr << mismatches << " mismatch(es) in " << fixture._starts.size() * 2 << " exploration(s)" << std::endl;
+        return 1;
+    }
+    std::cout << "Compared " << fixture._starts.size() * 2 << " exploration(s)" << std::endl;
+    return 0;
+}